@@ -9,9 +9,31 @@
 #include "./screens/DiagnosticConsole.cpp"
 #include "./screens/HardwareDetectionConsole.cpp"
 #include "./screens/MainMenu.cpp"
+#include "./screens/MemoryViewerConsole.cpp"
 #include "./screens/RAMTestSuiteConsole.cpp"
 #include "./screens/WelcomeConsole.cpp"
 
+// Memory access helpers
+#include "./memory/MemoryBus.cpp"
+#include "./memory/FaultLog.cpp"
+#include "./memory/MarchTest.cpp"
+#include "./memory/TestSuite.cpp"
+#include "./memory/RandomPattern.cpp"
+#include "./memory/SweepScheduler.cpp"
+#include "./memory/DramTopology.cpp"
+#include "./memory/RetentionTest.cpp"
+#include "./memory/AddressLineTest.cpp"
+#include "./memory/QuickScreen.cpp"
+#include "./memory/GalpatTest.cpp"
+#include "./memory/NpsfTest.cpp"
+#include "./memory/RowHammerTest.cpp"
+#include "./memory/SoakStats.cpp"
+#include "./memory/TestPlanner.cpp"
+#include "./memory/RefreshSweep.cpp"
+#include "./memory/TimingMargin.cpp"
+#include "./memory/SuiteComposition.cpp"
+#include "./memory/PatternSearch.cpp"
+
 // About screens
 #include "./screens/about/AboutConsole.cpp"
 
@@ -28,9 +50,21 @@
 #include "./screens/cassette/CassetteTestSuiteConsole.cpp"
 
 // DRAM screens
+#include "./screens/dram/CombinedTestSuiteConsole.cpp"
 #include "./screens/dram/DRAMContentViewerConsole.cpp"
+#include "./screens/dram/DRAMCustomSuiteConsole.cpp"
+#include "./screens/dram/DRAMGalpatConsole.cpp"
 #include "./screens/dram/DRAMMenu.cpp"
+#include "./screens/dram/DRAMPlannerConsole.cpp"
+#include "./screens/dram/DRAMRefreshConsole.cpp"
+#include "./screens/dram/DRAMRetentionConsole.cpp"
+#include "./screens/dram/DRAMRowHammerConsole.cpp"
+#include "./screens/dram/DRAMSeedReplayConsole.cpp"
+#include "./screens/dram/DRAMSoakConsole.cpp"
+#include "./screens/dram/DRAMSuiteComposerMenu.cpp"
 #include "./screens/dram/DRAMTestSuiteConsole.cpp"
+#include "./screens/dram/DRAMTimingConsole.cpp"
+#include "./screens/dram/DRAMTopologyConsole.cpp"
 
 // Keyboard screens
 #include "./screens/keyboard/KeyboardTester.cpp"
@@ -0,0 +1,109 @@
+#include "./AddressLineTest.h"
+
+#include <Arduino.h>
+
+#include "./MemoryBus.h"
+
+// Signature of probe n (index ADDRESS_LINES is the base); distinct and of even parity
+static uint8_t signature(uint8_t probe) {
+  uint8_t index = probe + 1;
+  uint8_t parity = index;
+  parity ^= parity >> 4;
+  parity ^= parity >> 2;
+  parity ^= parity >> 1;
+  return 0xA0 ^ (uint8_t)(index << 1) ^ (parity & 0x01);
+}
+
+// True if address is inside [start, start + length)
+static bool inRange(uint16_t address, uint16_t start, uint16_t length) {
+  return (uint16_t)(address - start) < length;
+}
+
+void AddressLineTest::run(uint16_t start, uint16_t length, AddressLineResult &lines) {
+  lines = {};
+  if (length < 2) {
+    return;
+  }
+
+  _probe(start, start, length, lines);
+  _probe(start + length - 1, start, length, lines);
+
+  // A line that collides with another line in either probe is shorted, not stuck
+  lines.stuck &= ~lines.shorted;
+}
+
+uint8_t AddressLineTest::getState(const AddressLineResult &lines, uint8_t line) {
+  uint16_t bit = 1 << line;
+  if (!(lines.tested & bit)) {
+    return ADDRESS_LINE_UNTESTED;
+  }
+  if (lines.shorted & bit) {
+    return ADDRESS_LINE_SHORTED;
+  }
+  if (lines.stuck & bit) {
+    return ADDRESS_LINE_STUCK;
+  }
+  return ADDRESS_LINE_OK;
+}
+
+void AddressLineTest::_probe(uint16_t base, uint16_t start, uint16_t length,
+                             AddressLineResult &lines) {
+  // Lines with a neighbour of the base inside the range
+  uint16_t probed = 0;
+  for (uint8_t n = 0; n < ADDRESS_LINES; n++) {
+    if (inRange(base ^ (1 << n), start, length)) {
+      probed |= (1 << n);
+    }
+  }
+  lines.tested |= probed;
+
+  // Base first, so a line that selects nothing overwrites the base signature
+  uint8_t value = signature(ADDRESS_LINES);
+  MemoryBus.writePage(base, &value, 1);
+  for (uint8_t n = 0; n < ADDRESS_LINES; n++) {
+    if (probed & (1 << n)) {
+      value = signature(n);
+      MemoryBus.writePage(base ^ (1 << n), &value, 1);
+    }
+  }
+
+  // Read back the base (index ADDRESS_LINES) and every neighbour
+  for (uint8_t n = 0; n <= ADDRESS_LINES; n++) {
+    bool isBase = (n == ADDRESS_LINES);
+    if (!isBase && !(probed & (1 << n))) {
+      continue;
+    }
+    MemoryBus.readPage(isBase ? base : (base ^ (1 << n)), &value, 1);
+    if (value == signature(n)) {
+      continue;
+    }
+
+    // Whose signature is it?
+    uint8_t owner = 0xFF;
+    for (uint8_t m = 0; m <= ADDRESS_LINES; m++) {
+      bool candidate = (m == ADDRESS_LINES) || (probed & (1 << m));
+      if (m != n && candidate && value == signature(m)) {
+        owner = m;
+        break;
+      }
+    }
+
+    if (owner == 0xFF) {
+      lines.dataErrors++;
+    } else if (isBase) {
+      lines.stuck |= (1 << owner);
+    } else if (owner == ADDRESS_LINES) {
+      lines.stuck |= (1 << n);
+    } else {
+      lines.shorted |= (1 << n) | (1 << owner);
+      lines.partner[n] = owner;
+      lines.partner[owner] = n;
+    }
+  }
+
+  uint8_t probes = 1;
+  for (uint16_t bits = probed; bits; bits &= bits - 1) {
+    probes++;
+  }
+  lines.operations += 2 * probes;
+}
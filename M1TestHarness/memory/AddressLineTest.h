@@ -0,0 +1,54 @@
+#ifndef ADDRESS_LINE_TEST_H
+#define ADDRESS_LINE_TEST_H
+
+#include <Arduino.h>
+
+#define ADDRESS_LINES 16
+
+// State of one address line
+#define ADDRESS_LINE_UNTESTED 0  // No pair of addresses in the range differs only in this line
+#define ADDRESS_LINE_OK 1
+#define ADDRESS_LINE_STUCK 2    // Does not change the selected cell (stuck or open)
+#define ADDRESS_LINE_SHORTED 3  // Selects the same cell as another line
+
+struct AddressLineResult {
+  uint16_t tested;                // Lines (bit n = An) with a probe in the range
+  uint16_t stuck;                 // ADDRESS_LINE_STUCK lines
+  uint16_t shorted;               // ADDRESS_LINE_SHORTED lines
+  uint8_t partner[ADDRESS_LINES];  // Line a shorted line collides with
+  uint8_t dataErrors;             // Probe cells that read back no known signature
+  uint16_t operations;            // Bus operations used
+};
+
+/**
+ * AddressLineTest - Finds stuck and shorted address lines in O(log n)
+ *
+ * Address uniqueness sweeps write (address & 0xFF) ^ pattern, which repeats
+ * every 256 bytes, so faults on A8-A15 go unnoticed. This test instead writes
+ * a unique signature to a base address and to every address that differs
+ * from it in exactly one line (base ^ 2^n), then reads them all back:
+ * - A line whose cell shows the base signature (or the other way round)
+ *   does not select anything: stuck or open
+ * - Two lines whose cells show each other's signature are shorted
+ *
+ * Two bases are probed, the first and the last address of the range, so the
+ * lines that are set in the first address (e.g. A14 for DRAM) are tested as
+ * well, and wired-AND and wired-OR shorts both show up. Each base costs
+ * 2 * (lines + 1) bus operations.
+ *
+ * Signatures have even parity, so a single failing data bit makes a cell read
+ * no signature at all; it is counted as a data error instead of aliasing.
+ */
+class AddressLineTest {
+ public:
+  // Probe all lines that have a pair of addresses inside the range
+  static void run(uint16_t start, uint16_t length, AddressLineResult &lines);
+
+  // ADDRESS_LINE_* state of a line
+  static uint8_t getState(const AddressLineResult &lines, uint8_t line);
+
+ private:
+  static void _probe(uint16_t base, uint16_t start, uint16_t length, AddressLineResult &lines);
+};
+
+#endif  // ADDRESS_LINE_TEST_H
@@ -0,0 +1,171 @@
+#include "./DramTopology.h"
+
+#include <Arduino.h>
+
+static const char TITLE_DIAGONAL[] PROGMEM = "Diagonal Screen (March B)";
+static const char TITLE_ROW_MAJOR[] PROGMEM = "Row-major March C-";
+static const char TITLE_COLUMN_MAJOR[] PROGMEM = "Column-major March C-";
+static const char TITLE_ROW_STRIPES[] PROGMEM = "Row Stripes (March C-)";
+static const char TITLE_COLUMN_STRIPES[] PROGMEM = "Column Stripes (March C-)";
+
+const DramTopologyTest DRAM_TOPOLOGY_TESTS[] PROGMEM = {
+    {TITLE_DIAGONAL, MARCH_ALGORITHM_B, DRAM_ORDER_DIAGONAL, DRAM_STRIPE_NONE},
+    {TITLE_ROW_MAJOR, MARCH_ALGORITHM_C_MINUS, DRAM_ORDER_ROW_MAJOR, DRAM_STRIPE_NONE},
+    {TITLE_COLUMN_MAJOR, MARCH_ALGORITHM_C_MINUS, DRAM_ORDER_COLUMN_MAJOR, DRAM_STRIPE_NONE},
+    {TITLE_ROW_STRIPES, MARCH_ALGORITHM_C_MINUS, DRAM_ORDER_ROW_STRIPE, DRAM_STRIPE_LINES},
+    {TITLE_COLUMN_STRIPES, MARCH_ALGORITHM_C_MINUS, DRAM_ORDER_COLUMN_MAJOR, DRAM_STRIPE_LINES},
+};
+const uint8_t DRAM_TOPOLOGY_TEST_COUNT =
+    sizeof(DRAM_TOPOLOGY_TESTS) / sizeof(DRAM_TOPOLOGY_TESTS[0]);
+
+const char *const DRAM_IC_REFS[8] = {"Z17", "Z16", "Z18", "Z19", "Z15", "Z20", "Z14", "Z13"};
+
+uint16_t DramTopology::_base = 0;
+uint8_t DramTopology::_banks = 0;
+uint8_t DramTopology::_test = DRAM_TOPOLOGY_TEST_COUNT;
+uint8_t DramTopology::_element = 0;
+uint16_t DramTopology::_line = 0;
+bool DramTopology::_delaying = false;
+uint32_t DramTopology::_delayStarted = 0;
+MarchSweep DramTopology::_sweep;
+
+uint16_t DramTopology::getAddress(uint16_t base, uint8_t bank, uint8_t row, uint8_t column) {
+  return base + (uint16_t)bank * DRAM_BANK_SIZE + ((uint16_t)column << FAULT_LOG_4116_BITS) + row;
+}
+
+void DramTopology::runSweep(const MarchSweep &sweep, uint16_t base, uint8_t banks, uint8_t order,
+                            uint8_t stripe, TestResult &result) {
+  _runLines(sweep, base, banks, order, stripe, 0, _getLineCount(order, banks), result);
+}
+
+uint16_t DramTopology::_getLineCount(uint8_t order, uint8_t banks) {
+  return (order == DRAM_ORDER_DIAGONAL) ? banks : (uint16_t)banks * DRAM_ROWS;
+}
+
+void DramTopology::_runLines(const MarchSweep &sweep, uint16_t base, uint8_t banks,
+                             uint8_t order, uint8_t stripe, uint16_t first, uint16_t count,
+                             TestResult &result) {
+  // Lines are counted in the order of the sweep, so a descending element
+  // sliced into steps still runs from the last line down
+  uint16_t lineCount = _getLineCount(order, banks);
+  if (order == DRAM_ORDER_DIAGONAL) {
+    for (uint16_t n = first; n < first + count; n++) {
+      uint8_t bank = sweep.descending ? (lineCount - 1 - n) : n;
+      MarchTest::runLine(sweep, getAddress(base, bank, 0, 0), DRAM_COLUMNS + 1, DRAM_ROWS,
+                         result);
+    }
+    return;
+  }
+
+  bool rows = (order != DRAM_ORDER_COLUMN_MAJOR);
+
+  // Stripe data runs every other line with the inverted values
+  MarchSweep inverted = sweep;
+  for (uint8_t k = 0; k < inverted.opCount; k++) {
+    inverted.ops[k].value = ~inverted.ops[k].value;
+  }
+
+  for (uint16_t n = first; n < first + count; n++) {
+    uint16_t position = sweep.descending ? (lineCount - 1 - n) : n;
+    uint8_t bank = position / DRAM_ROWS;
+    uint8_t line = position % DRAM_ROWS;
+    if (order == DRAM_ORDER_ROW_STRIPE) {
+      line = (line < DRAM_ROWS / 2) ? (line * 2) : ((line - DRAM_ROWS / 2) * 2 + 1);
+    }
+
+    const MarchSweep &lineSweep =
+        (stripe == DRAM_STRIPE_LINES && (line & 0x01)) ? inverted : sweep;
+    if (rows) {
+      MarchTest::runLine(lineSweep, getAddress(base, bank, line, 0), DRAM_ROWS, DRAM_COLUMNS,
+                         result);
+    } else {
+      MarchTest::runLine(lineSweep, getAddress(base, bank, 0, line), 1, DRAM_ROWS, result);
+    }
+  }
+}
+
+void DramTopology::begin(uint16_t base, uint8_t banks) {
+  _base = base;
+  _banks = banks;
+  _test = 0;
+  _element = 0;
+  _line = 0;
+  _delaying = false;
+}
+
+void DramTopology::step(TestResult &result, uint16_t maxLines) {
+  if (isDone()) {
+    return;
+  }
+
+  DramTopologyTest test;
+  memcpy_P(&test, &DRAM_TOPOLOGY_TESTS[_test], sizeof(test));
+  MarchAlgorithm algorithm = MarchTest::getAlgorithm(test.algorithm);
+
+  if (_delaying) {
+    if (millis() - _delayStarted >= MARCH_DEFAULT_DELAY_MS) {
+      _delaying = false;
+      _nextElement(algorithm.elementCount);
+    }
+    return;
+  }
+
+  if (_line == 0) {
+    uint16_t element = pgm_read_word(&algorithm.elements[_element]);
+    if (MARCH_ELEMENT_COUNT(element) == 0) {
+      _delaying = true;
+      _delayStarted = millis();
+      return;
+    }
+    FaultLog.setSource(FAULT_TEST_TOPOLOGY + _test, _element);
+    MarchTest::decodeElement(element, 0x00, MARCH_DATA_SOLID, _sweep);
+  }
+
+  uint16_t lineCount = _getLineCount(test.order, _banks);
+  uint16_t lines = (maxLines == 0 || maxLines > lineCount - _line) ? lineCount - _line : maxLines;
+  _runLines(_sweep, _base, _banks, test.order, test.stripe, _line, lines, result);
+  _line += lines;
+  if (_line >= lineCount) {
+    _nextElement(algorithm.elementCount);
+  }
+}
+
+void DramTopology::_nextElement(uint8_t elementCount) {
+  _line = 0;
+  if (++_element >= elementCount) {
+    _element = 0;
+    _test++;
+  }
+}
+
+bool DramTopology::isDone() {
+  return _test >= DRAM_TOPOLOGY_TEST_COUNT;
+}
+
+uint8_t DramTopology::getTest() {
+  return _test;
+}
+
+uint8_t DramTopology::getElement() {
+  return _element;
+}
+
+const __FlashStringHelper *DramTopology::getTitle(uint8_t testIndex) {
+  if (testIndex >= DRAM_TOPOLOGY_TEST_COUNT) {
+    return nullptr;
+  }
+  return (const __FlashStringHelper *)pgm_read_ptr(&DRAM_TOPOLOGY_TESTS[testIndex].title);
+}
+
+uint32_t DramTopology::getOperations(uint8_t testIndex, uint8_t banks) {
+  if (testIndex >= DRAM_TOPOLOGY_TEST_COUNT) {
+    return 0;
+  }
+
+  DramTopologyTest test;
+  memcpy_P(&test, &DRAM_TOPOLOGY_TESTS[testIndex], sizeof(test));
+  MarchAlgorithm algorithm = MarchTest::getAlgorithm(test.algorithm);
+  uint32_t cells = (test.order == DRAM_ORDER_DIAGONAL) ? DRAM_ROWS : (uint32_t)DRAM_BANK_SIZE;
+  return MarchTest::getOperationsPerCell(algorithm.elements, algorithm.elementCount) * cells *
+         banks;
+}
@@ -0,0 +1,99 @@
+#ifndef DRAM_TOPOLOGY_H
+#define DRAM_TOPOLOGY_H
+
+#include <Arduino.h>
+
+#include "./FaultLog.h"
+#include "./MarchTest.h"
+#include "./TestResult.h"
+
+// 4116 cell matrix: the Model I multiplexes A0-A6 as RAS (row) and A7-A13 as CAS (column)
+#define DRAM_ROWS (1 << FAULT_LOG_4116_BITS)
+#define DRAM_COLUMNS (1 << FAULT_LOG_4116_BITS)
+#define DRAM_BANK_SIZE 16384  // One set of eight 4116s
+
+// Physical visiting orders
+#define DRAM_ORDER_ROW_MAJOR 0     // All cells of a row (stride 128), then the next row
+#define DRAM_ORDER_COLUMN_MAJOR 1  // All cells of a column (linear), then the next column
+#define DRAM_ORDER_ROW_STRIPE 2    // Row-major over even rows, then odd rows
+#define DRAM_ORDER_DIAGONAL 3      // One cell per row and column (stride 129)
+
+// Line data: every other line inverted
+#define DRAM_STRIPE_NONE 0
+#define DRAM_STRIPE_LINES 1  // Adjacent rows (row orders) or columns (column order) opposite
+
+// One topology test (stored in PROGMEM)
+struct DramTopologyTest {
+  const char *title;  // PROGMEM string
+  uint8_t algorithm;  // MARCH_ALGORITHM_*
+  uint8_t order;      // DRAM_ORDER_*
+  uint8_t stripe;     // DRAM_STRIPE_*
+};
+
+extern const DramTopologyTest DRAM_TOPOLOGY_TESTS[] PROGMEM;
+extern const uint8_t DRAM_TOPOLOGY_TEST_COUNT;
+
+// IC of each data bit of the DRAM, bit 0 first (RAM strings, for Print)
+extern const char *const DRAM_IC_REFS[8];
+
+/**
+ * DramTopology - Runs March elements along the physical DRAM matrix
+ *
+ * Linear sweeps walk the 4116 matrix column by column (A0-A6 is the row), so
+ * word-line and sense-amp faults are only hit indirectly. This layer maps the
+ * linear range onto banks, rows and columns and runs each element line by
+ * line in the requested order:
+ * - Row-major and row-stripe orders stress word lines and the row decoder
+ * - Column-major order stresses bit lines and sense amplifiers
+ * - Stripe data puts opposite values on adjacent lines to expose shorts
+ * - The diagonal touches every row and every column of a bank with only 128
+ *   cells, a fast screen for dead lines
+ *
+ * All topology tests run as one sequence that is stepped a few lines at a
+ * time (begin()/step()), so a console keeps its buttons and display alive;
+ * delay elements end on a later step instead of blocking.
+ */
+class DramTopology {
+ public:
+  // Address of a cell in the matrix
+  static uint16_t getAddress(uint16_t base, uint8_t bank, uint8_t row, uint8_t column);
+
+  // Run a decoded element over all banks in the given order
+  static void runSweep(const MarchSweep &sweep, uint16_t base, uint8_t banks, uint8_t order,
+                       uint8_t stripe, TestResult &result);
+
+  // Run every topology test over banks starting at base (TEST signal and bus session active)
+  static void begin(uint16_t base, uint8_t banks);
+
+  // Run up to maxLines lines of the current element (a diagonal is one line per
+  // bank); errors accumulate into result
+  static void step(TestResult &result, uint16_t maxLines);
+  static bool isDone();
+
+  // Test and element the next step runs
+  static uint8_t getTest();
+  static uint8_t getElement();
+
+  // Title of a topology test (PROGMEM)
+  static const __FlashStringHelper *getTitle(uint8_t testIndex);
+
+  // Bus operations a topology test needs
+  static uint32_t getOperations(uint8_t testIndex, uint8_t banks);
+
+ private:
+  static uint16_t _base;
+  static uint8_t _banks;
+  static uint8_t _test;
+  static uint8_t _element;
+  static uint16_t _line;  // Lines of the element done
+  static bool _delaying;
+  static uint32_t _delayStarted;
+  static MarchSweep _sweep;  // Element at the cursor, decoded on its first step
+
+  static uint16_t _getLineCount(uint8_t order, uint8_t banks);
+  static void _runLines(const MarchSweep &sweep, uint16_t base, uint8_t banks, uint8_t order,
+                        uint8_t stripe, uint16_t first, uint16_t count, TestResult &result);
+  static void _nextElement(uint8_t elementCount);
+};
+
+#endif  // DRAM_TOPOLOGY_H
@@ -0,0 +1,117 @@
+#include "./FaultLog.h"
+
+#include <Arduino.h>
+
+// Global instance
+FaultLogClass FaultLog;
+
+FaultLogClass::FaultLogClass() {
+  begin(0x4000, FAULT_LOG_4116_BITS, FAULT_LOG_4116_BITS);
+}
+
+void FaultLogClass::begin(uint16_t base, uint8_t rowBits, uint8_t columnBits) {
+  _count = 0;
+  _total = 0;
+  _source = 0;
+  _paused = false;
+  _base = base;
+  _rowBits = rowBits;
+  _columnBits = columnBits;
+}
+
+void FaultLogClass::setSource(uint8_t test, uint8_t phase) {
+  if (_paused) {
+    return;
+  }
+  _source = (test << 3) | (phase & 0x07);
+}
+
+uint8_t FaultLogClass::getSource() const {
+  return _source;
+}
+
+void FaultLogClass::setPaused(bool paused) {
+  _paused = paused;
+}
+
+void FaultLogClass::record(uint16_t address, uint8_t expected, uint8_t actual) {
+  if (_paused) {
+    return;
+  }
+  _total++;
+  if (_count >= FAULT_LOG_CAPACITY) {
+    return;
+  }
+
+  FaultEntry &entry = _entries[_count++];
+  entry.address = address;
+  entry.expected = expected;
+  entry.actual = actual;
+  entry.source = _source;
+}
+
+uint8_t FaultLogClass::getCount() const {
+  return _count;
+}
+
+uint32_t FaultLogClass::getTotal() const {
+  return _total;
+}
+
+const FaultEntry &FaultLogClass::getEntry(uint8_t index) const {
+  return _entries[index];
+}
+
+uint8_t FaultLogClass::getBank(uint16_t address) const {
+  return (uint16_t)(address - _base) >> (_rowBits + _columnBits);
+}
+
+uint8_t FaultLogClass::getRow(uint16_t address) const {
+  return (address - _base) & ((1 << _rowBits) - 1);
+}
+
+uint8_t FaultLogClass::getColumn(uint16_t address) const {
+  return ((uint16_t)(address - _base) >> _rowBits) & ((1 << _columnBits) - 1);
+}
+
+uint8_t FaultLogClass::classify(uint8_t bit, uint16_t &firstAddress) const {
+  bool found = false;
+  bool sameRow = true;
+  bool sameColumn = true;
+
+  for (uint8_t i = 0; i < _count; i++) {
+    const FaultEntry &entry = _entries[i];
+    if (!((entry.expected ^ entry.actual) & (1 << bit))) {
+      continue;
+    }
+
+    if (!found) {
+      found = true;
+      firstAddress = entry.address;
+      continue;
+    }
+
+    // Rows and columns only match within the same bank of chips
+    bool sameBank = getBank(entry.address) == getBank(firstAddress);
+    if (!sameBank || getRow(entry.address) != getRow(firstAddress)) {
+      sameRow = false;
+    }
+    if (!sameBank || getColumn(entry.address) != getColumn(firstAddress)) {
+      sameColumn = false;
+    }
+  }
+
+  if (!found) {
+    return FAULT_PATTERN_NONE;
+  }
+  if (sameRow && sameColumn) {
+    return FAULT_PATTERN_CELL;
+  }
+  if (sameRow) {
+    return FAULT_PATTERN_ROW;
+  }
+  if (sameColumn) {
+    return FAULT_PATTERN_COLUMN;
+  }
+  return FAULT_PATTERN_SCATTERED;
+}
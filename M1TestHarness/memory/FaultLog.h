@@ -0,0 +1,94 @@
+#ifndef FAULT_LOG_H
+#define FAULT_LOG_H
+
+#include <Arduino.h>
+
+// Number of failures kept (5 bytes each)
+#define FAULT_LOG_CAPACITY 32
+
+// Cell matrix of the memory chips (row bits, column bits)
+#define FAULT_LOG_4116_BITS 7  // 4116 DRAM: 128 x 128, row = A0-A6, column = A7-A13
+#define FAULT_LOG_2102_BITS 5  // 2102 SRAM: 32 x 32, row = A0-A4, column = A5-A9
+
+// Failure patterns of a single chip
+#define FAULT_PATTERN_NONE 0
+#define FAULT_PATTERN_CELL 1       // One cell
+#define FAULT_PATTERN_ROW 2        // Several cells of one row
+#define FAULT_PATTERN_COLUMN 3     // Several cells of one column
+#define FAULT_PATTERN_SCATTERED 4  // No common row or column
+
+// One logged failure
+struct FaultEntry {
+  uint16_t address;
+  uint8_t expected;
+  uint8_t actual;
+  uint8_t source;  // Test number (bits 3-7) and phase within the test (bits 0-2)
+};
+
+#define FAULT_SOURCE_TEST(s) ((s) >> 3)
+#define FAULT_SOURCE_PHASE(s) ((s)&0x07)
+
+// Test numbers below FAULT_TEST_SUITE_END are titled RAM_TEST_SUITE tests; the
+// ones above tag tests outside the suite
+#define FAULT_TEST_SUITE_END 24
+#define FAULT_TEST_TOPOLOGY 24   // + topology test index (DRAM_TOPOLOGY_TESTS), up to 28
+#define FAULT_TEST_ROW_HAMMER 30
+#define FAULT_TEST_GALPAT 31     // Phase = background pass
+
+/**
+ * FaultLog - Fixed-size log of the first memory test failures
+ *
+ * TestResult only counts failures per bit; the log keeps where and how the
+ * first FAULT_LOG_CAPACITY failures happened so a run can tell a dead row or
+ * column from a single bad cell. Storage is static, nothing is allocated, and
+ * the passing path never touches the log (record() is only called on a
+ * mismatch).
+ *
+ * Each bit of the data bus is one chip, so the row/column analysis is done per
+ * bit on the logged entries; failures beyond the capacity are only counted.
+ */
+class FaultLogClass {
+ public:
+  FaultLogClass();
+
+  // Clear the log; base is the first address of the tested range
+  void begin(uint16_t base, uint8_t rowBits, uint8_t columnBits);
+
+  // Test and phase attributed to the following failures
+  void setSource(uint8_t test, uint8_t phase);
+  uint8_t getSource() const;
+
+  // While paused, record() and setSource() leave the log untouched (ranges
+  // tested alongside the logged one, see RAMTestSuiteConsole::runCombinedTest)
+  void setPaused(bool paused);
+
+  void record(uint16_t address, uint8_t expected, uint8_t actual);
+
+  uint8_t getCount() const;   // Entries held
+  uint32_t getTotal() const;  // All failures seen, including the ones not held
+  const FaultEntry &getEntry(uint8_t index) const;
+
+  // Chip coordinates of an address
+  uint8_t getBank(uint16_t address) const;
+  uint8_t getRow(uint16_t address) const;
+  uint8_t getColumn(uint16_t address) const;
+
+  // Failure pattern of one data bit; the first failing cell is returned in firstAddress
+  uint8_t classify(uint8_t bit, uint16_t &firstAddress) const;
+
+ private:
+  FaultEntry _entries[FAULT_LOG_CAPACITY];
+  uint8_t _count;
+  uint32_t _total;
+  uint8_t _source;
+  bool _paused;
+
+  uint16_t _base;
+  uint8_t _rowBits;
+  uint8_t _columnBits;
+};
+
+// Global instance access
+extern FaultLogClass FaultLog;
+
+#endif  // FAULT_LOG_H
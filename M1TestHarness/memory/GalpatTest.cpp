@@ -0,0 +1,139 @@
+#include "./GalpatTest.h"
+
+#include <Arduino.h>
+
+#include "./FaultLog.h"
+#include "./MemoryBus.h"
+
+// Neighbour addresses live on the stack, their reads in the bus scratch
+static_assert(GALPAT_MAX_NEIGHBOURS * 2 <= MEMORY_SCRATCH_SIZE, "Reads must fit the scratch");
+
+static uint8_t clampWindow(uint8_t window) {
+  if (window == 0) {
+    return 1;
+  }
+  return window > GALPAT_MAX_WINDOW ? GALPAT_MAX_WINDOW : window;
+}
+
+uint8_t GalpatTest::_collectNeighbours(uint16_t address, uint8_t row, uint8_t column,
+                                       uint8_t window, uint16_t *neighbours) {
+  // Rows are A0-A6 (+-1), columns A7-A13 (+-128); lines do not wrap
+  uint8_t count = 0;
+  for (uint8_t j = 1; j <= window; j++) {
+    uint16_t columnStep = (uint16_t)j << FAULT_LOG_4116_BITS;
+    if (row >= j) {
+      neighbours[count++] = address - j;
+    }
+    if (row + j < DRAM_ROWS) {
+      neighbours[count++] = address + j;
+    }
+    if (column >= j) {
+      neighbours[count++] = address - columnStep;
+    }
+    if (column + j < DRAM_COLUMNS) {
+      neighbours[count++] = address + columnStep;
+    }
+  }
+  return count;
+}
+
+void GalpatTest::run(uint16_t base, uint8_t banks, uint8_t window, TestResult &result,
+                     Print *progress) {
+  window = clampWindow(window);
+  uint16_t neighbours[GALPAT_MAX_NEIGHBOURS];
+  uint8_t *reads = MemoryBus.getScratch();
+  ErrorCounter errors = {};
+
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    uint8_t background = pass ? 0xFF : 0x00;
+    uint8_t inverse = ~background;
+    FaultLog.setSource(FAULT_TEST_GALPAT, pass);
+
+    uint32_t length = (uint32_t)banks * DRAM_BANK_SIZE;
+    for (uint32_t offset = 0; offset < length; offset += MEMORY_PAGE_SIZE) {
+      MemoryBus.fillPage(base + offset, background, MEMORY_PAGE_SIZE);
+    }
+
+    for (uint8_t bank = 0; bank < banks; bank++) {
+      for (uint8_t column = 0; column < DRAM_COLUMNS; column++) {
+        if (progress && (column & 0x1F) == 0) {
+          progress->print(F("."));
+        }
+        for (uint8_t row = 0; row < DRAM_ROWS; row++) {
+          uint16_t address = DramTopology::getAddress(base, bank, row, column);
+          uint8_t count = _collectNeighbours(address, row, column, window, neighbours);
+
+          MemoryBus.fillPage(address, inverse, 1);
+          MemoryBus.readAlternating(address, neighbours, count, reads);
+          MemoryBus.fillPage(address, background, 1);
+
+          uint8_t baseDiff = 0;
+          for (uint8_t i = 0; i < count; i++) {
+            uint8_t diff = reads[2 * i] ^ background;
+            if (diff != 0) {
+              FaultLog.record(neighbours[i], background, reads[2 * i]);
+              UPDATE_ERRORS(diff);
+            }
+            if (baseDiff == 0 && reads[2 * i + 1] != inverse) {
+              FaultLog.record(address, inverse, reads[2 * i + 1]);
+            }
+            baseDiff |= reads[2 * i + 1] ^ inverse;
+          }
+          UPDATE_ERRORS(baseDiff);
+        }
+      }
+    }
+  }
+  FLUSH_ERRORS;
+
+  if (progress) {
+    progress->println();
+  }
+}
+
+uint32_t GalpatTest::getOperations(uint8_t window, uint8_t banks) {
+  window = clampWindow(window);
+
+  // Neighbour pairs j apart: 2 * (128 - j) per line, 128 lines per direction
+  uint32_t neighbours = 0;
+  for (uint8_t j = 1; j <= window; j++) {
+    neighbours += 4UL * DRAM_ROWS * (DRAM_ROWS - j);
+  }
+
+  // Fill, two writes per base cell and two reads per neighbour, per background
+  uint32_t perBank = DRAM_BANK_SIZE + 2UL * DRAM_BANK_SIZE + 2 * neighbours;
+  return 2 * perBank * banks;
+}
+
+uint32_t GalpatTest::measureOpsPerSecond(uint16_t base, uint8_t window) {
+  window = clampWindow(window);
+
+  // Same work as run() on column 0, but every base keeps its content
+  uint16_t neighbours[GALPAT_MAX_NEIGHBOURS];
+  uint8_t *reads = MemoryBus.getScratch();
+  uint32_t operations = 0;
+  uint32_t started = micros();
+  for (uint8_t row = 0; row < GALPAT_CALIBRATION_CELLS; row++) {
+    uint16_t address = DramTopology::getAddress(base, 0, row, 0);
+    uint8_t count = _collectNeighbours(address, row, 0, window, neighbours);
+    uint8_t value;
+
+    MemoryBus.readPage(address, &value, 1);
+    MemoryBus.fillPage(address, ~value, 1);
+    MemoryBus.readAlternating(address, neighbours, count, reads);
+    MemoryBus.fillPage(address, value, 1);
+    operations += 3 + 2 * count;
+  }
+  uint32_t elapsed = micros() - started;
+  if (elapsed == 0) {
+    return 0;
+  }
+  return (uint32_t)((uint64_t)operations * 1000000 / elapsed);
+}
+
+uint32_t GalpatTest::getEstimatedMillis(uint8_t window, uint8_t banks, uint32_t opsPerSecond) {
+  if (opsPerSecond == 0) {
+    return 0;
+  }
+  return (uint32_t)((uint64_t)getOperations(window, banks) * 1000 / opsPerSecond);
+}
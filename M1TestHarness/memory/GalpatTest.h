@@ -0,0 +1,58 @@
+#ifndef GALPAT_TEST_H
+#define GALPAT_TEST_H
+
+#include <Arduino.h>
+
+#include "./DramTopology.h"
+#include "./TestResult.h"
+
+// Neighbours galloped per direction (rows and columns)
+#define GALPAT_DEFAULT_WINDOW 2
+#define GALPAT_MAX_WINDOW 16
+#define GALPAT_MAX_NEIGHBOURS (GALPAT_MAX_WINDOW * 4)
+
+// Base cells galloped to measure the bus rate for the estimate
+#define GALPAT_CALIBRATION_CELLS DRAM_ROWS
+
+/**
+ * GalpatTest - Windowed GALPAT (butterfly) over the physical DRAM matrix
+ *
+ * Full GALPAT reads every cell against every other one, O(n^2), which takes
+ * days for 16K over the harness bus. Coupling happens between physically
+ * close cells, so this test only gallops each base cell against the cells up
+ * to window rows and columns away in its 4116 matrix, O(n * window):
+ *
+ * - Fill the banks with the background
+ * - For every base cell: write the inverse, then alternate reads of each
+ *   neighbour (nearest first, in all four directions) and of the base, then
+ *   write the background back
+ * - A neighbour that does not read the background was disturbed by the write
+ *   of the base; a base that changes between the reads was disturbed by the
+ *   neighbour reads (counted once per base cell)
+ * - Repeated with background 0x00 and 0xFF
+ *
+ * getOperations() is exact, so the run time can be estimated from the rate
+ * measureOpsPerSecond() sees on a column of base cells (that gallop restores
+ * what memory held, nothing is lost before the test is started).
+ */
+class GalpatTest {
+ public:
+  // Gallop every cell of banks starting at base (TEST signal and bus session active)
+  static void run(uint16_t base, uint8_t banks, uint8_t window, TestResult &result,
+                  Print *progress = nullptr);
+
+  // Bus operations of run()
+  static uint32_t getOperations(uint8_t window, uint8_t banks);
+
+  // Gallop rate on this board in bus operations per second (bus session active)
+  static uint32_t measureOpsPerSecond(uint16_t base, uint8_t window);
+
+  // Run time of run() at opsPerSecond
+  static uint32_t getEstimatedMillis(uint8_t window, uint8_t banks, uint32_t opsPerSecond);
+
+ private:
+  static uint8_t _collectNeighbours(uint16_t address, uint8_t row, uint8_t column,
+                                    uint8_t window, uint16_t *neighbours);
+};
+
+#endif  // GALPAT_TEST_H
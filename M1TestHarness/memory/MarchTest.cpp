@@ -0,0 +1,205 @@
+#include "./MarchTest.h"
+
+#include <Arduino.h>
+
+#include "./FaultLog.h"
+
+
+// Textbook algorithms
+static const uint16_t MARCH_C_MINUS[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1),
+    MARCH_UP(MARCH_R1, MARCH_W0),
+    MARCH_DOWN(MARCH_R0, MARCH_W1),
+    MARCH_DOWN(MARCH_R1, MARCH_W0),
+    MARCH_UP(MARCH_R0),
+};
+
+static const uint16_t MATS_PLUS[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1),
+    MARCH_DOWN(MARCH_R1, MARCH_W0),
+};
+
+static const uint16_t MARCH_B[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1, MARCH_R1, MARCH_W0, MARCH_R0, MARCH_W1),
+    MARCH_UP(MARCH_R1, MARCH_W0, MARCH_W1),
+    MARCH_DOWN(MARCH_R1, MARCH_W0, MARCH_W1, MARCH_W0),
+    MARCH_DOWN(MARCH_R0, MARCH_W1, MARCH_W0),
+};
+
+static const uint16_t MARCH_Y[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1, MARCH_R1),
+    MARCH_DOWN(MARCH_R1, MARCH_W0, MARCH_R0),
+    MARCH_UP(MARCH_R0),
+};
+
+static const uint16_t MARCH_G[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1, MARCH_R1, MARCH_W0, MARCH_R0, MARCH_W1),
+    MARCH_UP(MARCH_R1, MARCH_W0, MARCH_W1),
+    MARCH_DOWN(MARCH_R1, MARCH_W0, MARCH_W1, MARCH_W0),
+    MARCH_DOWN(MARCH_R0, MARCH_W1, MARCH_W0),
+    MARCH_DELAY,
+    MARCH_UP(MARCH_R0, MARCH_W1, MARCH_R1),
+    MARCH_DELAY,
+    MARCH_UP(MARCH_R1, MARCH_W0, MARCH_R0),
+};
+
+static const char MARCH_C_MINUS_NAME[] PROGMEM = "March C-";
+static const char MATS_PLUS_NAME[] PROGMEM = "MATS+";
+static const char MARCH_B_NAME[] PROGMEM = "March B";
+static const char MARCH_Y_NAME[] PROGMEM = "March Y";
+static const char MARCH_G_NAME[] PROGMEM = "March G";
+
+// Adding an algorithm only needs its table and an entry here
+const MarchAlgorithm MARCH_ALGORITHMS[] PROGMEM = {
+    {MARCH_C_MINUS_NAME, MARCH_C_MINUS, sizeof(MARCH_C_MINUS) / sizeof(MARCH_C_MINUS[0])},
+    {MATS_PLUS_NAME, MATS_PLUS, sizeof(MATS_PLUS) / sizeof(MATS_PLUS[0])},
+    {MARCH_B_NAME, MARCH_B, sizeof(MARCH_B) / sizeof(MARCH_B[0])},
+    {MARCH_Y_NAME, MARCH_Y, sizeof(MARCH_Y) / sizeof(MARCH_Y[0])},
+    {MARCH_G_NAME, MARCH_G, sizeof(MARCH_G) / sizeof(MARCH_G[0])},
+};
+const uint8_t MARCH_ALGORITHM_COUNT = sizeof(MARCH_ALGORITHMS) / sizeof(MARCH_ALGORITHMS[0]);
+
+// Read-back buffer of an element: a page of the bus scratch
+static_assert(MEMORY_PAGE_SIZE <= MEMORY_SCRATCH_SIZE, "Read-back page must fit the scratch");
+
+void MarchTest::run(const uint16_t *elements, uint8_t elementCount, uint16_t start,
+                    uint16_t length, uint8_t background, TestResult &result, Print *progress,
+                    uint32_t delayMs) {
+  for (uint8_t e = 0; e < elementCount; e++) {
+    uint16_t element = pgm_read_word(&elements[e]);
+    if (progress) {
+      progress->print(F("."));
+    }
+
+    if (MARCH_ELEMENT_COUNT(element) == 0) {
+      delay(delayMs);
+    } else {
+      MarchSweep sweep;
+      decodeElement(element, background, MARCH_DATA_SOLID, sweep);
+      runSweep(sweep, start, length, result);
+    }
+  }
+  if (progress) {
+    progress->println();
+  }
+}
+
+void MarchTest::run(uint8_t algorithmIndex, uint16_t start, uint16_t length, uint8_t background,
+                    TestResult &result, Print *progress, uint32_t delayMs) {
+  if (algorithmIndex >= MARCH_ALGORITHM_COUNT) {
+    return;
+  }
+
+  MarchAlgorithm algorithm = getAlgorithm(algorithmIndex);
+  run(algorithm.elements, algorithm.elementCount, start, length, background, result, progress,
+      delayMs);
+}
+
+const __FlashStringHelper *MarchTest::getAlgorithmName(uint8_t algorithmIndex) {
+  if (algorithmIndex >= MARCH_ALGORITHM_COUNT) {
+    return nullptr;
+  }
+  return (const __FlashStringHelper *)pgm_read_ptr(&MARCH_ALGORITHMS[algorithmIndex].name);
+}
+
+MarchAlgorithm MarchTest::getAlgorithm(uint8_t algorithmIndex) {
+  MarchAlgorithm algorithm = {};
+  if (algorithmIndex < MARCH_ALGORITHM_COUNT) {
+    memcpy_P(&algorithm, &MARCH_ALGORITHMS[algorithmIndex], sizeof(algorithm));
+  }
+  return algorithm;
+}
+
+uint8_t MarchTest::getOperationsPerCell(const uint16_t *elements, uint8_t elementCount) {
+  uint8_t operations = 0;
+  for (uint8_t e = 0; e < elementCount; e++) {
+    operations += MARCH_ELEMENT_COUNT(pgm_read_word(&elements[e]));
+  }
+  return operations;
+}
+
+void MarchTest::decodeElement(uint16_t element, uint8_t background, uint8_t data,
+                              MarchSweep &sweep, uint16_t seed) {
+  sweep.opCount = MARCH_ELEMENT_COUNT(element);
+  sweep.onceMask = 0;
+  sweep.descending = MARCH_ELEMENT_DOWN(element);
+
+  for (uint8_t k = 0; k < sweep.opCount; k++) {
+    uint8_t op = MARCH_ELEMENT_OP(element, k);
+    MemoryOperation &operation = sweep.ops[k];
+    operation.write = op & 0x02;
+    operation.value = (op & 0x01) ? (uint8_t)~background : background;
+    operation.addressMask = (data == MARCH_DATA_ADDRESS) ? 0xFF : 0x00;
+    operation.oddMask = (data == MARCH_DATA_CHECKERBOARD) ? 0xFF : 0x00;
+    operation.seed = (data == MARCH_DATA_RANDOM) ? seed : 0;
+  }
+}
+
+void MarchTest::runSweep(const MarchSweep &sweep, uint16_t start, uint16_t length,
+                         TestResult &result) {
+  runLine(sweep, start, 1, length, result);
+}
+
+void MarchTest::runLine(const MarchSweep &sweep, uint16_t address, uint16_t stride,
+                        uint16_t count, TestResult &result) {
+  uint8_t readsPerCell = 0;
+  for (uint8_t k = 0; k < sweep.opCount; k++) {
+    if (!sweep.ops[k].write) {
+      readsPerCell++;
+    }
+  }
+
+  // Every read of a chunk must fit into the buffer
+  uint16_t chunk = readsPerCell ? (MEMORY_PAGE_SIZE / readsPerCell) : MEMORY_PAGE_SIZE;
+  uint16_t chunkCount = (count + chunk - 1) / chunk;
+
+  uint8_t *buffer = MemoryBus.getScratch();
+  ErrorCounter errors = {};
+  for (uint16_t c = 0; c < chunkCount; c++) {
+    uint16_t index = sweep.descending ? (chunkCount - 1 - c) : c;
+    uint16_t offset = index * chunk;
+    uint16_t cells = (count - offset) < chunk ? (count - offset) : chunk;
+    uint16_t cell = address + offset * stride;
+
+    MemoryBus.sequenceStride(cell, stride, cells, sweep.ops, sweep.opCount, buffer,
+                             sweep.descending);
+    if (readsPerCell == 0) {
+      continue;
+    }
+
+    const uint8_t *data = buffer;
+    for (uint16_t i = 0; i < cells; i++, cell += stride) {
+      uint8_t onceDiff = 0;
+      for (uint8_t k = 0; k < sweep.opCount; k++) {
+        const MemoryOperation &operation = sweep.ops[k];
+        if (operation.write) {
+          continue;
+        }
+        uint8_t expected = memoryOperationValue(operation, cell);
+        uint8_t actual = *data++;
+        uint8_t diff = actual ^ expected;
+        if (diff == 0) {
+          continue;
+        }
+
+        // Only mismatches reach the log
+        if (sweep.onceMask & (1 << k)) {
+          if (onceDiff == 0) {
+            FaultLog.record(cell, expected, actual);
+          }
+          onceDiff |= diff;
+        } else {
+          FaultLog.record(cell, expected, actual);
+          UPDATE_ERRORS(diff);
+        }
+      }
+      UPDATE_ERRORS(onceDiff);
+    }
+  }
+  FLUSH_ERRORS;
+}
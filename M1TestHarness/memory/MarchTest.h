@@ -0,0 +1,136 @@
+#ifndef MARCH_TEST_H
+#define MARCH_TEST_H
+
+#include <Arduino.h>
+
+#include "./MemoryBus.h"
+#include "./TestResult.h"
+
+/**
+ * MarchTest - Interpreter for March algorithms stored as PROGMEM element tables
+ *
+ * A March algorithm is a list of elements, each applying a short sequence of
+ * read/write operations to every cell in ascending or descending address order,
+ * e.g. March C-: (w0); up(r0,w1); up(r1,w0); down(r0,w1); down(r1,w0); (r0).
+ *
+ * On byte-wide memory "0" is the background pattern and "1" its inverse, so one
+ * table serves any background (0x00, 0x55, random, ...).
+ *
+ * Element encoding (one uint16_t per element):
+ * - Bit 15:     Address order (0 = ascending, 1 = descending)
+ * - Bits 12-14: Number of operations (1-6, 0 = delay element)
+ * - Bits 0-11:  Operations, two bits each starting at bit 0:
+ *               bit 1 = write (1) / read (0), bit 0 = inverse (1) / background (0)
+ *
+ * Tables are built with the MARCH_UP/MARCH_DOWN/MARCH_DELAY macros:
+ *
+ *   const uint16_t MATS_PLUS[] PROGMEM = {
+ *       MARCH_UP(MARCH_W0), MARCH_UP(MARCH_R0, MARCH_W1), MARCH_DOWN(MARCH_R1, MARCH_W0)};
+ *
+ * Each element runs as one tight loop per address: all of its operations are
+ * applied while the address is driven once (see MemoryBus::sequencePage).
+ */
+
+// Operations
+#define MARCH_R0 0
+#define MARCH_R1 1
+#define MARCH_W0 2
+#define MARCH_W1 3
+
+#define MARCH_MAX_OPS 6
+#define MARCH_DESCENDING 0x8000
+
+// Element decoding
+#define MARCH_ELEMENT_DOWN(e) (((e)&MARCH_DESCENDING) != 0)
+#define MARCH_ELEMENT_COUNT(e) (((e) >> 12) & 0x07)
+#define MARCH_ELEMENT_OP(e, i) (((e) >> (2 * (i))) & 0x03)
+
+// Element construction (1 to 6 operations)
+#define _MARCH_OPS1(a) ((uint16_t)(a))
+#define _MARCH_OPS2(a, b) (_MARCH_OPS1(a) | ((uint16_t)(b) << 2))
+#define _MARCH_OPS3(a, b, c) (_MARCH_OPS2(a, b) | ((uint16_t)(c) << 4))
+#define _MARCH_OPS4(a, b, c, d) (_MARCH_OPS3(a, b, c) | ((uint16_t)(d) << 6))
+#define _MARCH_OPS5(a, b, c, d, e) (_MARCH_OPS4(a, b, c, d) | ((uint16_t)(e) << 8))
+#define _MARCH_OPS6(a, b, c, d, e, f) (_MARCH_OPS5(a, b, c, d, e) | ((uint16_t)(f) << 10))
+#define _MARCH_NARGS(...) _MARCH_NARGS_(__VA_ARGS__, 6, 5, 4, 3, 2, 1)
+#define _MARCH_NARGS_(_1, _2, _3, _4, _5, _6, N, ...) N
+#define _MARCH_CAT(a, b) _MARCH_CAT_(a, b)
+#define _MARCH_CAT_(a, b) a##b
+#define _MARCH_ELEMENT(down, ...)                                                \
+  ((uint16_t)((down) ? MARCH_DESCENDING : 0) |                                   \
+   ((uint16_t)_MARCH_NARGS(__VA_ARGS__) << 12) |                                 \
+   _MARCH_CAT(_MARCH_OPS, _MARCH_NARGS(__VA_ARGS__))(__VA_ARGS__))
+
+#define MARCH_UP(...) _MARCH_ELEMENT(0, __VA_ARGS__)
+#define MARCH_DOWN(...) _MARCH_ELEMENT(1, __VA_ARGS__)
+#define MARCH_DELAY ((uint16_t)0)
+
+#define MARCH_TABLE(table) (table), (uint8_t)(sizeof(table) / sizeof((table)[0]))
+
+// Default hold time of a delay element
+#define MARCH_DEFAULT_DELAY_MS 1000
+
+// Cell data: how the background varies with the address
+#define MARCH_DATA_SOLID 0         // Background in every cell
+#define MARCH_DATA_CHECKERBOARD 1  // Background inverted on odd addresses
+#define MARCH_DATA_ADDRESS 2       // Background XOR low address byte
+#define MARCH_DATA_RANDOM 3        // Background XOR pseudorandom byte of (seed, address)
+
+// A decoded element, ready to run as one pass over a range
+struct MarchSweep {
+  MemoryOperation ops[MARCH_MAX_OPS];
+  uint8_t opCount;    // 0 = delay
+  uint8_t onceMask;   // Reads (by op index) whose failures count once per cell
+  bool descending;
+};
+
+// Named algorithm for menus and catalogs (stored in PROGMEM)
+struct MarchAlgorithm {
+  const char *name;          // PROGMEM string
+  const uint16_t *elements;  // PROGMEM element table
+  uint8_t elementCount;
+};
+
+// Textbook algorithms (indexes into MARCH_ALGORITHMS)
+#define MARCH_ALGORITHM_C_MINUS 0
+#define MARCH_ALGORITHM_MATS_PLUS 1
+#define MARCH_ALGORITHM_B 2
+#define MARCH_ALGORITHM_Y 3
+#define MARCH_ALGORITHM_G 4
+
+extern const MarchAlgorithm MARCH_ALGORITHMS[] PROGMEM;
+extern const uint8_t MARCH_ALGORITHM_COUNT;
+
+class MarchTest {
+ public:
+  // Run a PROGMEM element table over a range; prints one '.' per element to progress
+  static void run(const uint16_t *elements, uint8_t elementCount, uint16_t start,
+                  uint16_t length, uint8_t background, TestResult &result,
+                  Print *progress = nullptr, uint32_t delayMs = MARCH_DEFAULT_DELAY_MS);
+
+  // Run a catalog entry from MARCH_ALGORITHMS
+  static void run(uint8_t algorithmIndex, uint16_t start, uint16_t length, uint8_t background,
+                  TestResult &result, Print *progress = nullptr,
+                  uint32_t delayMs = MARCH_DEFAULT_DELAY_MS);
+
+  // Name and element table of a catalog entry (PROGMEM)
+  static const __FlashStringHelper *getAlgorithmName(uint8_t algorithmIndex);
+  static MarchAlgorithm getAlgorithm(uint8_t algorithmIndex);
+
+  // Number of bus operations per cell (for run time estimates)
+  static uint8_t getOperationsPerCell(const uint16_t *elements, uint8_t elementCount);
+
+  // Decode one element for the given background and cell data (seed: MARCH_DATA_RANDOM)
+  static void decodeElement(uint16_t element, uint8_t background, uint8_t data,
+                            MarchSweep &sweep, uint16_t seed = 0);
+
+  // Run a decoded element over a range and verify every read
+  static void runSweep(const MarchSweep &sweep, uint16_t start, uint16_t length,
+                       TestResult &result);
+
+  // Run a decoded element over count cells stride bytes apart and verify every read
+  static void runLine(const MarchSweep &sweep, uint16_t address, uint16_t stride, uint16_t count,
+                      TestResult &result);
+};
+
+#endif  // MARCH_TEST_H
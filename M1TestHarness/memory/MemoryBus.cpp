@@ -0,0 +1,287 @@
+#include "./MemoryBus.h"
+
+#include <Arduino.h>
+#include <Model1.h>
+#include <Model1LowLevel.h>
+
+#include "../globals.h"
+
+// Bus settle time between strobe and data sampling (62.5ns per NOP at 16MHz)
+#define MEMORY_BUS_SETTLE() __asm__ __volatile__("nop\n\tnop\n\tnop\n\tnop\n\tnop\n\tnop\n\t")
+
+// Global instance
+MemoryBusClass MemoryBus;
+
+uint8_t MemoryBusClass::_scratch[MEMORY_SCRATCH_SIZE];
+
+// Single read cycle; the caller has configured the data bus as input
+static inline uint8_t readCell(uint16_t address) {
+  uint8_t oldSREG = SREG;
+  cli();
+  Model1LowLevel::writeAddressBus(address);
+  Model1LowLevel::writeRD(LOW);
+  MEMORY_BUS_SETTLE();
+  uint8_t data = Model1LowLevel::readDataBus();
+  Model1LowLevel::writeRD(HIGH);
+  SREG = oldSREG;
+  return data;
+}
+
+// Single write cycle; the caller has configured the data bus as output
+static inline void writeCell(uint16_t address, uint8_t value) {
+  uint8_t oldSREG = SREG;
+  cli();
+  Model1LowLevel::writeAddressBus(address);
+  Model1LowLevel::writeDataBus(value);
+  Model1LowLevel::writeWR(LOW);
+  MEMORY_BUS_SETTLE();
+  Model1LowLevel::writeWR(HIGH);
+  SREG = oldSREG;
+}
+
+MemoryBusClass::MemoryBusClass() {
+  _sessionActive = false;
+  _dataBusOutput = false;
+  resetStats();
+}
+
+bool MemoryBusClass::beginSession() {
+  if (!Model1.hasActiveTestSignal()) {
+    Globals.logger.errF(F("MemoryBus session requires an active TEST signal"));
+    return false;
+  }
+
+  // Strobes inactive (high) before they are driven
+  Model1LowLevel::writeRD(HIGH);
+  Model1LowLevel::writeWR(HIGH);
+  Model1LowLevel::configWriteRD(OUTPUT);
+  Model1LowLevel::configWriteWR(OUTPUT);
+
+  Model1LowLevel::configWriteAddressBus(0xFFFF);
+  Model1LowLevel::configWriteDataBus(0x00);
+  _dataBusOutput = false;
+
+  _sessionActive = true;
+  return true;
+}
+
+void MemoryBusClass::endSession() {
+  if (!_sessionActive) {
+    return;
+  }
+
+  // Never leave the bus driven once the session is over: the Z80 may run
+  // right after (as DiagnosticConsole releases the pins)
+  _setDataBusOutput(false);
+  Model1LowLevel::configWriteAddressBus(0x0000);
+  Model1LowLevel::configWriteRD(INPUT);
+  Model1LowLevel::writeRD(LOW);
+  Model1LowLevel::configWriteWR(INPUT);
+  Model1LowLevel::writeWR(LOW);
+  _sessionActive = false;
+}
+
+bool MemoryBusClass::isSessionActive() const {
+  return _sessionActive;
+}
+
+void MemoryBusClass::readPage(uint16_t address, uint8_t *buffer, uint16_t length,
+                              bool descending) {
+  if (!_sessionActive || length == 0) {
+    return;
+  }
+
+  uint32_t startMicros = micros();
+  _setDataBusOutput(false);
+  if (descending) {
+    for (uint16_t i = length; i-- > 0;) {
+      buffer[i] = readCell(address + i);
+    }
+  } else {
+    for (uint16_t i = 0; i < length; i++) {
+      buffer[i] = readCell(address + i);
+    }
+  }
+  _readCount += length;
+  _busMicros += micros() - startMicros;
+}
+
+void MemoryBusClass::writePage(uint16_t address, const uint8_t *buffer, uint16_t length,
+                               bool descending) {
+  if (!_sessionActive || length == 0) {
+    return;
+  }
+
+  uint32_t startMicros = micros();
+  _setDataBusOutput(true);
+  if (descending) {
+    for (uint16_t i = length; i-- > 0;) {
+      writeCell(address + i, buffer[i]);
+    }
+  } else {
+    for (uint16_t i = 0; i < length; i++) {
+      writeCell(address + i, buffer[i]);
+    }
+  }
+  _setDataBusOutput(false);
+  _writeCount += length;
+  _busMicros += micros() - startMicros;
+}
+
+void MemoryBusClass::fillPage(uint16_t address, uint8_t value, uint16_t length, bool descending) {
+  if (!_sessionActive || length == 0) {
+    return;
+  }
+
+  uint32_t startMicros = micros();
+  _setDataBusOutput(true);
+  if (descending) {
+    for (uint16_t i = length; i-- > 0;) {
+      writeCell(address + i, value);
+    }
+  } else {
+    for (uint16_t i = 0; i < length; i++) {
+      writeCell(address + i, value);
+    }
+  }
+  _setDataBusOutput(false);
+  _writeCount += length;
+  _busMicros += micros() - startMicros;
+}
+
+void MemoryBusClass::readAlternating(uint16_t address, const uint16_t *addresses,
+                                     uint8_t count, uint8_t *buffer) {
+  if (!_sessionActive || count == 0) {
+    return;
+  }
+
+  uint32_t startMicros = micros();
+  _setDataBusOutput(false);
+  for (uint8_t i = 0; i < count; i++) {
+    *buffer++ = readCell(addresses[i]);
+    *buffer++ = readCell(address);
+  }
+  _readCount += (uint32_t)count * 2;
+  _busMicros += micros() - startMicros;
+}
+
+uint32_t MemoryBusClass::hammer(uint16_t first, uint16_t second, uint16_t pairs) {
+  if (!_sessionActive || pairs == 0) {
+    return 0;
+  }
+
+  // Only the address and RD are driven; refresh may run between the pairs
+  uint32_t startMicros = micros();
+  _setDataBusOutput(false);
+  for (uint16_t i = 0; i < pairs; i++) {
+    uint8_t oldSREG = SREG;
+    cli();
+    Model1LowLevel::writeAddressBus(first);
+    Model1LowLevel::writeRD(LOW);
+    MEMORY_BUS_SETTLE();
+    Model1LowLevel::writeRD(HIGH);
+    Model1LowLevel::writeAddressBus(second);
+    Model1LowLevel::writeRD(LOW);
+    MEMORY_BUS_SETTLE();
+    Model1LowLevel::writeRD(HIGH);
+    SREG = oldSREG;
+  }
+  uint32_t elapsed = micros() - startMicros;
+  _readCount += (uint32_t)pairs * 2;
+  _busMicros += elapsed;
+  return elapsed;
+}
+
+void MemoryBusClass::sequencePage(uint16_t address, uint16_t length,
+                                  const MemoryOperation *ops, uint8_t opCount, uint8_t *buffer,
+                                  bool descending) {
+  sequenceStride(address, 1, length, ops, opCount, buffer, descending);
+}
+
+void MemoryBusClass::sequenceStride(uint16_t address, uint16_t stride, uint16_t count,
+                                    const MemoryOperation *ops, uint8_t opCount,
+                                    uint8_t *buffer, bool descending) {
+  if (!_sessionActive || count == 0 || opCount == 0) {
+    return;
+  }
+
+  uint8_t readsPerCell = 0;
+  for (uint8_t k = 0; k < opCount; k++) {
+    if (!ops[k].write) {
+      readsPerCell++;
+    }
+  }
+
+  uint32_t startMicros = micros();
+  for (uint16_t n = 0; n < count; n++) {
+    uint16_t i = descending ? (count - 1 - n) : n;
+    uint16_t cell = address + i * stride;
+    uint8_t *out = buffer + (uint16_t)(i * readsPerCell);
+
+    uint8_t oldSREG = SREG;
+    cli();
+    Model1LowLevel::writeAddressBus(cell);
+    for (uint8_t k = 0; k < opCount; k++) {
+      if (ops[k].write) {
+        _setDataBusOutput(true);
+        Model1LowLevel::writeDataBus(memoryOperationValue(ops[k], cell));
+        Model1LowLevel::writeWR(LOW);
+        MEMORY_BUS_SETTLE();
+        Model1LowLevel::writeWR(HIGH);
+      } else {
+        _setDataBusOutput(false);
+        Model1LowLevel::writeRD(LOW);
+        MEMORY_BUS_SETTLE();
+        *out++ = Model1LowLevel::readDataBus();
+        Model1LowLevel::writeRD(HIGH);
+      }
+    }
+    SREG = oldSREG;
+  }
+  _setDataBusOutput(false);
+  _readCount += (uint32_t)count * readsPerCell;
+  _writeCount += (uint32_t)count * (opCount - readsPerCell);
+  _busMicros += micros() - startMicros;
+}
+
+uint8_t *MemoryBusClass::getScratch() {
+  return _scratch;
+}
+
+void MemoryBusClass::resetStats() {
+  _readCount = 0;
+  _writeCount = 0;
+  _busMicros = 0;
+}
+
+uint32_t MemoryBusClass::getReadCount() const {
+  return _readCount;
+}
+
+uint32_t MemoryBusClass::getWriteCount() const {
+  return _writeCount;
+}
+
+uint32_t MemoryBusClass::getBusOperations() const {
+  return _readCount + _writeCount;
+}
+
+uint32_t MemoryBusClass::getBusTimeMicros() const {
+  return _busMicros;
+}
+
+uint32_t MemoryBusClass::getBytesPerSecond() const {
+  if (_busMicros == 0) {
+    return 0;
+  }
+  // Scale in 64-bit to avoid overflowing on long runs
+  return (uint32_t)(((uint64_t)getBusOperations() * 1000000UL) / _busMicros);
+}
+
+void MemoryBusClass::_setDataBusOutput(bool output) {
+  if (_dataBusOutput == output) {
+    return;
+  }
+  Model1LowLevel::configWriteDataBus(output ? 0xFF : 0x00);
+  _dataBusOutput = output;
+}
@@ -0,0 +1,138 @@
+#ifndef MEMORY_BUS_H
+#define MEMORY_BUS_H
+
+#include <Arduino.h>
+
+// Number of bytes moved per burst transfer
+#define MEMORY_PAGE_SIZE 256
+
+// Scratch memory the tests share (read-back pages, per-row state); only one
+// test runs at a time, so they take turns instead of each keeping its own
+#define MEMORY_SCRATCH_SIZE 512
+
+// One operation of a sequencePage() cell sequence. The value used for a cell is
+// value ^ (low address byte & addressMask) ^ (odd address ? oddMask : 0), plus a
+// pseudorandom byte of the address if seed is non-zero. This covers solid,
+// checkerboard, address-derived and random data without a per-cell buffer.
+struct MemoryOperation {
+  uint8_t write;  // Non-zero for a write, zero for a read
+  uint8_t value;
+  uint8_t addressMask;
+  uint8_t oddMask;
+  uint16_t seed;  // Non-zero adds memoryRandomByte(seed, address)
+};
+
+// Pseudorandom byte of an address (xorshift of address and seed, then a seed-dependent
+// multiply). Regenerated for verification, so random data needs no buffer and every
+// address can be visited in any order.
+static inline uint8_t memoryRandomByte(uint16_t seed, uint16_t address) {
+  uint16_t x = address ^ seed;
+  x ^= x << 7;
+  x ^= x >> 9;
+  x ^= x << 8;
+  x *= (uint16_t)((seed ^ 0x9E36) | 0x0001);
+  return (uint8_t)(x >> 8);
+}
+
+// Value an operation writes to (or expects from) the cell at address
+static inline uint8_t memoryOperationValue(const MemoryOperation &op, uint16_t address) {
+  uint8_t low = (uint8_t)address;
+  uint8_t value = op.value ^ (low & op.addressMask) ^ ((low & 0x01) ? op.oddMask : 0x00);
+  return op.seed ? (value ^ memoryRandomByte(op.seed, address)) : value;
+}
+
+/**
+ * MemoryBus - Burst page transfers between the harness and Model I memory
+ *
+ * Model1.readMemory()/writeMemory() re-validate the bus, reconfigure the address
+ * and data bus directions and log on every single byte. For the memory tests that
+ * overhead dominates the run time. MemoryBus configures the bus once per session
+ * and then only drives the address, strobes RD/WR and samples the data bus for
+ * every cell of a page.
+ *
+ * Usage:
+ * - Activate the TEST signal (Model1.activateTestSignal())
+ * - beginSession() once, transfer any number of pages, endSession() (releases
+ *   the address and data bus and RD/WR to inputs)
+ * - Deactivate the TEST signal
+ *
+ * Every cell access runs with interrupts disabled so the Timer2 refresh ISR can
+ * never interleave with a half-finished bus cycle, but refresh still runs between
+ * cells.
+ *
+ * Features:
+ * - Page read/write/fill from and to local buffers
+ * - Read/write operation sequences with the address driven once per cell
+ * - Ascending or descending address order
+ * - Alternating reads between one cell and a list of others
+ * - Row hammering with a minimal read loop
+ * - Bus operation and bus time statistics for throughput reporting
+ */
+class MemoryBusClass {
+ public:
+  MemoryBusClass();
+
+  // Session control (TEST signal must already be active)
+  bool beginSession();
+  void endSession();
+  bool isSessionActive() const;
+
+  // Read length bytes starting at address into buffer (buffer[i] = memory[address + i])
+  void readPage(uint16_t address, uint8_t *buffer, uint16_t length, bool descending = false);
+
+  // Write length bytes from buffer starting at address
+  void writePage(uint16_t address, const uint8_t *buffer, uint16_t length,
+                 bool descending = false);
+
+  // Write the same value to length bytes starting at address
+  void fillPage(uint16_t address, uint8_t value, uint16_t length, bool descending = false);
+
+  // Apply opCount read/write operations to every cell with the address driven once per
+  // cell. Reads are stored cell-major (the reads of cell i start at buffer[i * readsPerCell]).
+  void sequencePage(uint16_t address, uint16_t length, const MemoryOperation *ops,
+                    uint8_t opCount, uint8_t *buffer, bool descending = false);
+
+  // Same as sequencePage() for count cells stride bytes apart (e.g. one DRAM row)
+  void sequenceStride(uint16_t address, uint16_t stride, uint16_t count,
+                      const MemoryOperation *ops, uint8_t opCount, uint8_t *buffer,
+                      bool descending = false);
+
+  // Read addresses[i] and then address again for every i (galloping). Reads are
+  // stored in pairs: buffer[2 * i] = addresses[i], buffer[2 * i + 1] = address.
+  void readAlternating(uint16_t address, const uint16_t *addresses, uint8_t count,
+                       uint8_t *buffer);
+
+  // Read first and second alternately pairs times as fast as the bus allows (no data
+  // is sampled); every access activates the DRAM row of its address. Returns the time
+  // taken in microseconds.
+  uint32_t hammer(uint16_t first, uint16_t second, uint16_t pairs);
+
+  // Shared scratch buffer (MEMORY_SCRATCH_SIZE bytes); its content belongs to
+  // the test that wrote it last
+  uint8_t *getScratch();
+
+  // Statistics
+  void resetStats();
+  uint32_t getReadCount() const;
+  uint32_t getWriteCount() const;
+  uint32_t getBusOperations() const;
+  uint32_t getBusTimeMicros() const;
+  uint32_t getBytesPerSecond() const;
+
+ private:
+  bool _sessionActive;
+  bool _dataBusOutput;  // Current data bus direction (true = driving)
+
+  uint32_t _readCount;
+  uint32_t _writeCount;
+  uint32_t _busMicros;  // Time spent inside page transfers
+
+  static uint8_t _scratch[MEMORY_SCRATCH_SIZE];
+
+  void _setDataBusOutput(bool output);
+};
+
+// Global instance access
+extern MemoryBusClass MemoryBus;
+
+#endif  // MEMORY_BUS_H
@@ -0,0 +1,91 @@
+#include "./NpsfTest.h"
+
+#include <Arduino.h>
+
+#include "./MarchTest.h"
+#include "./MemoryBus.h"
+
+// Group written by each transition: an Eulerian circuit of the directed 5-cube
+// starting and ending with all groups at 0
+static const uint8_t NPSF_TRANSITIONS[NPSF_TRANSITION_COUNT] PROGMEM = {
+    0, 0, 1, 0, 0, 1, 2, 0, 0, 1, 0, 0, 1, 2, 3, 0, 0, 1, 0, 0,  //
+    1, 2, 0, 0, 1, 0, 0, 1, 2, 3, 4, 0, 0, 1, 0, 0, 1, 2, 0, 0,  //
+    1, 0, 0, 1, 2, 3, 0, 0, 1, 0, 0, 1, 2, 0, 0, 1, 0, 1, 1, 2,  //
+    1, 1, 2, 3, 1, 1, 2, 1, 1, 2, 3, 4, 1, 1, 2, 1, 1, 2, 3, 1,  //
+    1, 2, 1, 2, 2, 3, 2, 2, 3, 4, 2, 2, 3, 2, 3, 3, 4, 3, 4, 4,  //
+    3, 4, 2, 4, 4, 3, 4, 1, 3, 3, 4, 3, 4, 4, 3, 4, 2, 4, 4, 3,  //
+    4, 0, 2, 2, 3, 2, 2, 3, 4, 2, 2, 3, 2, 3, 3, 4, 3, 4, 4, 3,  //
+    4, 2, 4, 4, 3, 4, 1, 3, 3, 4, 3, 4, 4, 3, 4, 2, 4, 4, 3, 4,  //
+};
+
+// No group is written by the verify-only sweeps
+#define NPSF_NO_GROUP 0xFF
+
+NpsfTest::NpsfTest() {
+  begin(0x4000, 0, 7);
+}
+
+void NpsfTest::begin(uint16_t start, uint16_t length, uint8_t matrixBits) {
+  _start = start;
+  _length = length;
+  _matrixSize = (uint16_t)1 << (matrixBits * 2);
+  _step = 0;
+  _state = 0;
+}
+
+void NpsfTest::_sweep(uint8_t writeGroup, TestResult &result) {
+  for (uint32_t offset = 0; offset < _length; offset += _matrixSize) {
+    uint16_t remaining = _length - offset;
+    uint16_t size = remaining < _matrixSize ? remaining : _matrixSize;
+
+    // Groups restart at every matrix, its size is not a multiple of 5
+    for (uint8_t group = 0; group < NPSF_GROUPS && group < size; group++) {
+      uint8_t value = (_state & (1 << group)) ? 0xFF : 0x00;
+      MarchSweep sweep = {};
+      sweep.ops[0] = {0, value, 0x00, 0x00, 0};
+      sweep.opCount = 1;
+      if (group == writeGroup) {
+        sweep.ops[1] = {1, (uint8_t)~value, 0x00, 0x00, 0};
+        sweep.opCount = 2;
+      }
+      MarchTest::runLine(sweep, _start + offset + group, NPSF_GROUPS,
+                         (size - group + NPSF_GROUPS - 1) / NPSF_GROUPS, result);
+    }
+  }
+}
+
+void NpsfTest::step(TestResult &result) {
+  if (isDone()) {
+    return;
+  }
+
+  if (_step == 0) {
+    for (uint32_t offset = 0; offset < _length; offset += MEMORY_PAGE_SIZE) {
+      uint16_t remaining = _length - offset;
+      MemoryBus.fillPage(_start + offset, 0x00,
+                         remaining < MEMORY_PAGE_SIZE ? remaining : MEMORY_PAGE_SIZE);
+    }
+  } else if (_step <= NPSF_TRANSITION_COUNT) {
+    uint8_t group = pgm_read_byte(&NPSF_TRANSITIONS[_step - 1]);
+    _sweep(group, result);
+    _state ^= (1 << group);
+  } else {
+    _sweep(NPSF_NO_GROUP, result);
+  }
+  _step++;
+}
+
+bool NpsfTest::isDone() const {
+  return _step >= NPSF_STEP_COUNT;
+}
+
+uint8_t NpsfTest::getStep() const {
+  return _step;
+}
+
+uint32_t NpsfTest::getOperations(uint16_t length) {
+  // Fill, a read of every cell per transition and verify, plus the group writes
+  uint32_t reads = (uint32_t)length * (NPSF_TRANSITION_COUNT + 1);
+  uint32_t writes = (uint32_t)length + (uint32_t)length * NPSF_TRANSITION_COUNT / NPSF_GROUPS;
+  return reads + writes;
+}
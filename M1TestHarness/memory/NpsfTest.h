@@ -0,0 +1,62 @@
+#ifndef NPSF_TEST_H
+#define NPSF_TEST_H
+
+#include <Arduino.h>
+
+#include "./TestResult.h"
+
+// Type-1 neighbourhood: base cell and its four row/column neighbours
+#define NPSF_GROUPS 5
+#define NPSF_PATTERNS (1 << NPSF_GROUPS)
+#define NPSF_TRANSITION_COUNT (NPSF_PATTERNS * NPSF_GROUPS)  // Every cell up and down under every pattern
+
+// Steps: initial fill, one per transition, final verify
+#define NPSF_STEP_COUNT (NPSF_TRANSITION_COUNT + 2)
+
+/**
+ * NpsfTest - Type-1 neighbourhood pattern-sensitive faults by tiling
+ *
+ * A type-1 neighbourhood is a cell with the cells above, below, left and
+ * right of it in the chip matrix. Colouring every cell with
+ * (row + column * (columnStep mod 5)) mod 5 tiles the matrix so that each
+ * neighbourhood holds exactly one cell of every colour (group). With the
+ * Model I address mapping that colour is simply the offset in the bank
+ * modulo 5, so every group is a stride-5 sweep.
+ *
+ * Writing a whole group changes one cell of every neighbourhood at once. The
+ * groups are written along an Eulerian circuit of the directed 5-cube
+ * (NPSF_TRANSITION_COUNT writes of n / 5 cells), which is the minimum that
+ * makes every cell go up and down under all 16 patterns of its neighbours
+ * (active NPSF) and passes every neighbourhood through all 32 patterns
+ * (passive/static NPSF). Each step verifies all cells and writes the next
+ * group in the same pass; all eight chips are tested in parallel.
+ *
+ * One step costs about 1.2 * n bus operations and is the unit for step(), so
+ * callers can run the test in bounded slices.
+ */
+class NpsfTest {
+ public:
+  NpsfTest();
+
+  // Start on a range made of whole chip matrices of matrixBits x matrixBits
+  void begin(uint16_t start, uint16_t length, uint8_t matrixBits);
+
+  // Run the next step; errors accumulate into result
+  void step(TestResult &result);
+  bool isDone() const;
+  uint8_t getStep() const;
+
+  // Bus operations of a whole run over length bytes
+  static uint32_t getOperations(uint16_t length);
+
+ private:
+  uint16_t _start;
+  uint16_t _length;
+  uint16_t _matrixSize;
+  uint8_t _step;
+  uint8_t _state;  // Bit n = value of group n (0x00 or 0xFF in memory)
+
+  void _sweep(uint8_t writeGroup, TestResult &result);
+};
+
+#endif  // NPSF_TEST_H
@@ -0,0 +1,132 @@
+#include "./PatternSearch.h"
+
+#include <Arduino.h>
+
+// Global instance
+PatternSearchClass PatternSearch;
+
+static int8_t hexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+PatternSearchClass::PatternSearchClass() {
+  _length = 0;
+}
+
+bool PatternSearchClass::begin(const uint8_t *pattern, uint8_t length) {
+  if (length == 0 || length > SEARCH_MAX_PATTERN) {
+    _length = 0;
+    return false;
+  }
+  memcpy(_pattern, pattern, length);
+  _length = length;
+  return true;
+}
+
+bool PatternSearchClass::begin(const char *text) {
+  uint8_t pattern[SEARCH_MAX_PATTERN];
+  uint8_t length = 0;
+
+  // Quoted text
+  size_t size = strlen(text);
+  if (size >= 2 && (text[0] == '"' || text[0] == '\'') && text[size - 1] == text[0]) {
+    return begin((const uint8_t *)text + 1, size - 2);
+  }
+
+  if (_parseHex(text, pattern, length)) {
+    return begin(pattern, length);
+  }
+  return begin((const uint8_t *)text, size > SEARCH_MAX_PATTERN ? 0 : size);
+}
+
+uint8_t PatternSearchClass::getLength() const {
+  return _length;
+}
+
+bool PatternSearchClass::find(uint16_t start, uint32_t end, uint16_t &address, uint8_t *buffer,
+                              uint16_t size) {
+  if (_length == 0 || size < SEARCH_MIN_BUFFER || (uint32_t)start + _length > end) {
+    return false;
+  }
+
+  // Shift for the window byte under the last pattern position
+  uint8_t *skip = buffer;
+  uint8_t last = _length - 1;
+  memset(skip, _length, SEARCH_SKIP_SIZE);
+  for (uint8_t k = 0; k < last; k++) {
+    skip[_pattern[k]] = last - k;
+  }
+
+  uint8_t *window = buffer + SEARCH_SKIP_SIZE;
+  uint16_t windowSize = size - SEARCH_SKIP_SIZE;
+  uint32_t windowStart = start;  // Address of window[0]
+  uint32_t next = start;         // Next address to read
+  uint16_t kept = 0;             // Bytes carried over from the previous burst
+
+  while (next < end) {
+    uint16_t room = windowSize - kept;
+    uint16_t count = (end - next < room) ? end - next : room;
+    MemoryBus.readPage(next, window + kept, count);
+    next += count;
+
+    uint16_t filled = kept + count;
+    uint16_t i = 0;
+    while (i + _length <= filled) {
+      uint8_t tail = window[i + last];
+      if (tail == _pattern[last] && memcmp(window + i, _pattern, last) == 0) {
+        address = windowStart + i;
+        return true;
+      }
+      i += skip[tail];
+    }
+
+    // Alignments from i on still need bytes of the next burst
+    kept = filled - i;
+    memmove(window, window + i, kept);
+    windowStart += i;
+  }
+  return false;
+}
+
+bool PatternSearchClass::_parseHex(const char *text, uint8_t *pattern, uint8_t &length) {
+  length = 0;
+  while (*text) {
+    if (*text == ' ' || *text == ',') {
+      text++;
+      continue;
+    }
+    if (text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+      text += 2;
+    }
+
+    // One or two hex digits, optionally with an h suffix, per byte
+    int8_t high = hexValue(*text);
+    if (high < 0 || length == SEARCH_MAX_PATTERN) {
+      return false;
+    }
+    uint8_t value = high;
+    text++;
+    int8_t low = hexValue(*text);
+    if (low >= 0) {
+      value = (value << 4) | low;
+      text++;
+    }
+    if (*text == 'h' || *text == 'H') {
+      text++;
+    }
+    if (*text && *text != ' ' && *text != ',') {
+      return false;
+    }
+    pattern[length++] = value;
+  }
+  return length > 0;
+}
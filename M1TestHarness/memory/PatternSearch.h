@@ -0,0 +1,57 @@
+#ifndef PATTERN_SEARCH_H
+#define PATTERN_SEARCH_H
+
+#include <Arduino.h>
+
+#include "./MemoryBus.h"
+
+// Longest pattern
+#define SEARCH_MAX_PATTERN 32
+
+// Smallest buffer find() works in: the skip table and a window of twice the
+// longest pattern (larger windows mean fewer, longer bursts)
+#define SEARCH_SKIP_SIZE 256
+#define SEARCH_MIN_BUFFER (SEARCH_SKIP_SIZE + 2 * SEARCH_MAX_PATTERN)
+
+/**
+ * PatternSearch - Boyer-Moore-Horspool search of a byte pattern over the bus
+ *
+ * The range is streamed through a window one burst at a time; the last bytes
+ * of a burst that could still start a match are kept for the next one. Every
+ * byte is read exactly once, so a search over all 64K costs no more than one
+ * sequential burst read, and a hit stops the read.
+ *
+ * Only the pattern is kept between searches. The skip table and the window
+ * live in a buffer the caller lends to find() (e.g. a page buffer it reads
+ * again afterwards), so an idle search holds no SRAM beyond the pattern.
+ * Skips never pass the end of the window, so the kept tail is always shorter
+ * than the pattern.
+ */
+class PatternSearchClass {
+ public:
+  PatternSearchClass();
+
+  // Pattern of 1 to SEARCH_MAX_PATTERN bytes; false if it does not fit
+  bool begin(const uint8_t *pattern, uint8_t length);
+
+  // Pattern from text: "text" or 'text' in quotes, else hex bytes separated by
+  // spaces or commas (C3 00 06, 0xC3,0x00), else the text as it is
+  bool begin(const char *text);
+
+  uint8_t getLength() const;
+
+  // First match in start up to (not including) end (bus session active);
+  // buffer (at least SEARCH_MIN_BUFFER bytes) is overwritten
+  bool find(uint16_t start, uint32_t end, uint16_t &address, uint8_t *buffer, uint16_t size);
+
+ private:
+  uint8_t _pattern[SEARCH_MAX_PATTERN];
+  uint8_t _length;
+
+  static bool _parseHex(const char *text, uint8_t *pattern, uint8_t &length);
+};
+
+// Global instance access
+extern PatternSearchClass PatternSearch;
+
+#endif  // PATTERN_SEARCH_H
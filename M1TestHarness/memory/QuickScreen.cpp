@@ -0,0 +1,82 @@
+#include "./QuickScreen.h"
+
+#include <Arduino.h>
+
+#include "./AddressLineTest.h"
+#include "./MarchTest.h"
+
+// Backgrounds the sample lines are run with
+static const uint8_t SCREEN_BACKGROUNDS[] = {0x00, 0x55};
+
+void QuickScreen::run(uint16_t start, uint16_t length, uint8_t matrixBits,
+                      ScreenResult &screen) {
+  screen = {};
+
+  uint32_t blockSize = (uint32_t)1 << (2 * matrixBits);
+  uint16_t lineCells = 1 << matrixBits;
+  MarchAlgorithm algorithm = MarchTest::getAlgorithm(MARCH_ALGORITHM_MATS_PLUS);
+
+  for (uint8_t g = 0; g < sizeof(SCREEN_BACKGROUNDS); g++) {
+    for (uint8_t e = 0; e < algorithm.elementCount; e++) {
+      MarchSweep sweep;
+      MarchTest::decodeElement(pgm_read_word(&algorithm.elements[e]), SCREEN_BACKGROUNDS[g],
+                               MARCH_DATA_SOLID, sweep);
+
+      for (uint32_t offset = 0; offset < length; offset += blockSize) {
+        uint32_t remaining = length - offset;
+        uint8_t block = offset / blockSize;
+        uint32_t errors = screen.result.totalErrors;
+
+        // Column 0 holds one cell of every row, row 0 one cell of every other column
+        uint16_t rows = (remaining < lineCells) ? remaining : lineCells;
+        uint16_t columns = (remaining >> matrixBits) < lineCells ? (remaining >> matrixBits)
+                                                                   : lineCells;
+        MarchTest::runLine(sweep, start + offset, 1, rows, screen.result);
+        if (columns > 1) {
+          MarchTest::runLine(sweep, start + offset + lineCells, lineCells, columns - 1,
+                             screen.result);
+        }
+
+        if (screen.result.totalErrors != errors) {
+          screen.blockMask |= (1 << block);
+        }
+      }
+    }
+  }
+
+  AddressLineResult lines;
+  AddressLineTest::run(start, length, lines);
+  screen.addressLines = lines.stuck | lines.shorted;
+}
+
+bool QuickScreen::passed(const ScreenResult &screen) {
+  return screen.result.totalErrors == 0 && screen.addressLines == 0;
+}
+
+void QuickScreen::getRegion(const ScreenResult &screen, uint16_t start, uint16_t length,
+                            uint8_t matrixBits, uint16_t &regionStart, uint16_t &regionLength) {
+  regionStart = start;
+  regionLength = length;
+  if (screen.addressLines != 0 || screen.blockMask == 0) {
+    return;
+  }
+
+  // First to last failing block
+  uint32_t blockSize = (uint32_t)1 << (2 * matrixBits);
+  uint8_t first = 0;
+  while (!(screen.blockMask & (1 << first))) {
+    first++;
+  }
+  uint8_t last = 7;
+  while (!(screen.blockMask & (1 << last))) {
+    last--;
+  }
+
+  uint32_t begin = (uint32_t)first * blockSize;
+  uint32_t end = (uint32_t)(last + 1) * blockSize;
+  if (end > length) {
+    end = length;
+  }
+  regionStart = start + begin;
+  regionLength = end - begin;
+}
@@ -0,0 +1,42 @@
+#ifndef QUICK_SCREEN_H
+#define QUICK_SCREEN_H
+
+#include <Arduino.h>
+
+#include "./TestResult.h"
+
+// Outcome of a screening pass
+struct ScreenResult {
+  TestResult result;      // Data errors of the row/column samples
+  uint16_t addressLines;  // Stuck or shorted address lines (bit n = An)
+  uint8_t blockMask;      // Matrix-sized blocks (banks) with data errors
+};
+
+/**
+ * QuickScreen - Seconds-long screening pass for production testing
+ *
+ * Most boards either pass everything or fail obviously, so a short probe
+ * decides whether the full suite is needed at all:
+ * - MATS+ with solid and 0x55 backgrounds on one line of cells per row
+ *   (column 0) and one per column (row 0) of every RAM matrix, so each data
+ *   bit, each row and each column sees both values
+ * - The address line probe (see AddressLineTest), which catches stuck and
+ *   shorted address lines
+ *
+ * getRegion() narrows the range the full suite has to run on to the blocks
+ * that failed (or the whole range if an address line is suspect).
+ */
+class QuickScreen {
+ public:
+  // Screen the range; matrixBits is the row/column width of one RAM chip
+  static void run(uint16_t start, uint16_t length, uint8_t matrixBits, ScreenResult &screen);
+
+  // True if the screen found nothing
+  static bool passed(const ScreenResult &screen);
+
+  // Range that needs the full suite after a failed screen
+  static void getRegion(const ScreenResult &screen, uint16_t start, uint16_t length,
+                        uint8_t matrixBits, uint16_t &regionStart, uint16_t &regionLength);
+};
+
+#endif  // QUICK_SCREEN_H
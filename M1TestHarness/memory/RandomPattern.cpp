@@ -0,0 +1,49 @@
+#include "./RandomPattern.h"
+
+#include <Arduino.h>
+
+#include "./FaultLog.h"
+#include "./MarchTest.h"
+#include "./TestSuite.h"
+
+uint16_t RandomPattern::_lastSeed = 0;
+
+uint16_t RandomPattern::newSeed() {
+  _lastSeed = (uint16_t)random(1, 0x10000);
+  return _lastSeed;
+}
+
+uint16_t RandomPattern::getLastSeed() {
+  return _lastSeed;
+}
+
+uint16_t RandomPattern::getSeed(uint16_t seed, uint16_t pass, uint16_t stride) {
+  uint16_t passSeed = seed + pass * stride;
+  return passSeed ? passSeed : 0xFFFF;
+}
+
+void RandomPattern::run(uint16_t start, uint16_t length, uint16_t seed, uint16_t passes,
+                        uint16_t stride, TestResult &result, Print *progress) {
+  for (uint16_t pass = 0; pass < passes; pass++) {
+    uint16_t passSeed = getSeed(seed, pass, stride);
+    if (progress) {
+      progress->print(F(" seed 0x"));
+      progress->print(passSeed, HEX);
+    }
+
+    for (uint8_t e = 0; e < MOVING_INVERSION_COUNT; e++) {
+      if (progress) {
+        progress->print(F("."));
+      }
+      FaultLog.setSource(0, e);
+
+      MarchSweep sweep;
+      MarchTest::decodeElement(pgm_read_word(&MOVING_INVERSION[e]), 0x00, MARCH_DATA_RANDOM,
+                               sweep, passSeed);
+      MarchTest::runSweep(sweep, start, length, result);
+    }
+  }
+  if (progress) {
+    progress->println();
+  }
+}
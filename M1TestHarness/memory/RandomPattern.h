@@ -0,0 +1,41 @@
+#ifndef RANDOM_PATTERN_H
+#define RANDOM_PATTERN_H
+
+#include <Arduino.h>
+
+#include "./TestResult.h"
+
+#define RANDOM_PATTERN_DEFAULT_PASSES 1
+#define RANDOM_PATTERN_DEFAULT_STRIDE 1
+
+/**
+ * RandomPattern - Moving inversion with a pseudorandom value in every cell
+ *
+ * Every address gets its own byte from memoryRandomByte(seed, address); the
+ * verify step regenerates it instead of storing it, so the test needs no
+ * buffer and works in both address directions. The same seed reproduces a
+ * run bit for bit, so the seed is printed with every pass.
+ *
+ * For soak runs the test repeats with seed, seed + stride, seed + 2 * stride,
+ * ... Seed 0 means "no random data" in MemoryOperation and is never used.
+ */
+class RandomPattern {
+ public:
+  // A fresh seed (never 0)
+  static uint16_t newSeed();
+
+  // Last seed newSeed() returned, to replay it (0 if none was drawn yet)
+  static uint16_t getLastSeed();
+
+  // Seed of pass n of a run
+  static uint16_t getSeed(uint16_t seed, uint16_t pass, uint16_t stride);
+
+  // Run passes passes over a range; prints the seed and one '.' per element to progress
+  static void run(uint16_t start, uint16_t length, uint16_t seed, uint16_t passes,
+                  uint16_t stride, TestResult &result, Print *progress = nullptr);
+
+ private:
+  static uint16_t _lastSeed;
+};
+
+#endif  // RANDOM_PATTERN_H
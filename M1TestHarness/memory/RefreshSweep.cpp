@@ -0,0 +1,237 @@
+#include "./RefreshSweep.h"
+
+#include <Arduino.h>
+
+#include "./DramTopology.h"
+#include "./MemoryBus.h"
+
+// Timer2 counts CPU cycles through the prescaler selected by CS22:CS20
+#define TIMER2_CLOCK_SELECT 0x07
+#define TIMER2_MAX_TICKS (256UL * 1024)
+#define TICKS_PER_MICROSECOND (F_CPU / 1000000UL)
+
+static const uint16_t TIMER2_PRESCALERS[] PROGMEM = {0, 1, 8, 32, 64, 128, 256, 1024};
+
+// Interval multiples of the default refresh, one per step
+static const uint8_t REFRESH_SWEEP_FACTORS[REFRESH_SWEEP_MAX_STEPS] PROGMEM = {
+    1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128};
+
+// Pages are verified in the bus scratch
+static_assert(MEMORY_PAGE_SIZE <= MEMORY_SCRATCH_SIZE, "Verify page must fit the scratch");
+
+uint32_t RefreshSweep::_baseTicks = 0;
+uint8_t RefreshSweep::_stepCount = 0;
+uint8_t RefreshSweep::_failStep[8];
+
+uint16_t RefreshSweep::_start = 0;
+uint16_t RefreshSweep::_length = 0;
+uint8_t RefreshSweep::_steps = 0;
+uint8_t RefreshSweep::_step = 0;
+uint8_t RefreshSweep::_phase = REFRESH_SWEEP_DONE;
+uint8_t RefreshSweep::_pattern = 0xFF;
+uint8_t RefreshSweep::_failed = 0;
+uint8_t RefreshSweep::_bits = 0;
+uint16_t RefreshSweep::_offset = 0;
+uint32_t RefreshSweep::_dwellMs = 0;
+uint32_t RefreshSweep::_dwellStarted = 0;
+uint8_t RefreshSweep::_savedControl = 0;
+uint8_t RefreshSweep::_savedCompare = 0;
+
+bool RefreshSweep::begin(uint16_t start, uint16_t length) {
+  memset(_failStep, REFRESH_SWEEP_HELD, sizeof(_failStep));
+  _stepCount = 0;
+  _phase = REFRESH_SWEEP_DONE;
+
+  _baseTicks = _getTimerTicks();
+  if (_baseTicks == 0 || !(TIMSK2 & (1 << OCIE2A))) {
+    return false;
+  }
+
+  // Only the clock select and compare value change; the mode stays as set up
+  _savedControl = TCCR2B;
+  _savedCompare = OCR2A;
+
+  _start = start;
+  _length = length;
+  _steps = _getStepCount(_baseTicks);
+  _step = 0;
+  _failed = 0;
+  _startStep();
+  return true;
+}
+
+void RefreshSweep::step() {
+  switch (_phase) {
+    case REFRESH_SWEEP_FILL:
+      MemoryBus.fillPage(_start + _offset, _pattern, MEMORY_PAGE_SIZE);
+      _offset += MEMORY_PAGE_SIZE;
+      if (_offset >= _length) {
+        // No bus access while holding: only the refresh ISR keeps the rows alive
+        _dwellStarted = millis();
+        _phase = REFRESH_SWEEP_DWELL;
+      }
+      break;
+
+    case REFRESH_SWEEP_DWELL:
+      if (millis() - _dwellStarted >= _dwellMs) {
+        _offset = 0;
+        _phase = REFRESH_SWEEP_VERIFY;
+      }
+      break;
+
+    case REFRESH_SWEEP_VERIFY: {
+      uint8_t *page = MemoryBus.getScratch();
+      MemoryBus.readPage(_start + _offset, page, MEMORY_PAGE_SIZE);
+      for (uint16_t i = 0; i < MEMORY_PAGE_SIZE; i++) {
+        _bits |= page[i] ^ _pattern;
+      }
+      _offset += MEMORY_PAGE_SIZE;
+      if (_offset >= _length) {
+        _endHold();
+      }
+      break;
+    }
+  }
+}
+
+bool RefreshSweep::isDone() {
+  return _phase == REFRESH_SWEEP_DONE;
+}
+
+void RefreshSweep::cancel() {
+  if (_phase != REFRESH_SWEEP_DONE) {
+    _restoreTimer();
+    _phase = REFRESH_SWEEP_DONE;
+  }
+}
+
+uint8_t RefreshSweep::getStep() {
+  return _step;
+}
+
+void RefreshSweep::_startStep() {
+  uint32_t ticks = _getStepTicks(_baseTicks, _step);
+  _dwellMs = _getDwellMillis(ticks);
+  _setTimerTicks(ticks);
+
+  _pattern = 0xFF;
+  _bits = 0;
+  _offset = 0;
+  _phase = REFRESH_SWEEP_FILL;
+}
+
+void RefreshSweep::_endHold() {
+  _offset = 0;
+  if (_pattern == 0xFF) {
+    _pattern = 0x00;
+    _phase = REFRESH_SWEEP_FILL;
+    return;
+  }
+
+  for (uint8_t b = 0; b < 8; b++) {
+    if ((_bits & ~_failed) & (1 << b)) {
+      _failStep[b] = _step;
+    }
+  }
+  _failed |= _bits;
+  _stepCount = ++_step;
+
+  if (_step >= _steps || _failed == 0xFF) {
+    _restoreTimer();
+    _phase = REFRESH_SWEEP_DONE;
+    return;
+  }
+  _startStep();
+}
+
+void RefreshSweep::_restoreTimer() {
+  uint8_t oldSREG = SREG;
+  cli();
+  TCCR2B = _savedControl;
+  OCR2A = _savedCompare;
+  TCNT2 = 0;
+  SREG = oldSREG;
+}
+
+uint8_t RefreshSweep::getBitFailStep(uint8_t bit) {
+  return _failStep[bit & 0x07];
+}
+
+uint32_t RefreshSweep::getBitHeldMicros(uint8_t bit) {
+  uint8_t step = _failStep[bit & 0x07];
+  if (step == REFRESH_SWEEP_HELD) {
+    return (_stepCount > 0) ? getStepMicros(_stepCount - 1) : 0;
+  }
+  return (step > 0) ? getStepMicros(step - 1) : 0;
+}
+
+uint32_t RefreshSweep::getStepMicros(uint8_t step) {
+  return _getStepTicks(_baseTicks, step) / TICKS_PER_MICROSECOND;
+}
+
+uint8_t RefreshSweep::getStepCount() {
+  return _stepCount;
+}
+
+uint32_t RefreshSweep::getDefaultMicros() {
+  return _getTimerTicks() / TICKS_PER_MICROSECOND;
+}
+
+uint32_t RefreshSweep::getMaxDurationMillis(uint16_t length) {
+  uint32_t baseTicks = _getTimerTicks();
+  if (baseTicks == 0) {
+    return 0;
+  }
+
+  // Two holds per step plus a fill and a verify of the range for each
+  uint32_t busMillis = (uint32_t)length * 4 / 1000;
+  uint32_t total = 0;
+  uint8_t steps = _getStepCount(baseTicks);
+  for (uint8_t step = 0; step < steps; step++) {
+    total += 2 * (_getDwellMillis(_getStepTicks(baseTicks, step)) + busMillis);
+  }
+  return total;
+}
+
+uint32_t RefreshSweep::_getTimerTicks() {
+  uint16_t prescaler = pgm_read_word(&TIMER2_PRESCALERS[TCCR2B & TIMER2_CLOCK_SELECT]);
+  return (uint32_t)(OCR2A + 1) * prescaler;
+}
+
+uint32_t RefreshSweep::_getStepTicks(uint32_t baseTicks, uint8_t step) {
+  uint32_t ticks = baseTicks * pgm_read_byte(&REFRESH_SWEEP_FACTORS[step]);
+  return (ticks > TIMER2_MAX_TICKS) ? TIMER2_MAX_TICKS : ticks;
+}
+
+uint8_t RefreshSweep::_getStepCount(uint32_t baseTicks) {
+  // The sweep ends with the first step Timer2 cannot stretch any further
+  uint8_t steps = 1;
+  while (steps < REFRESH_SWEEP_MAX_STEPS && _getStepTicks(baseTicks, steps - 1) < TIMER2_MAX_TICKS) {
+    steps++;
+  }
+  return steps;
+}
+
+uint32_t RefreshSweep::_getDwellMillis(uint32_t ticks) {
+  // Two full refresh cycles if every interrupt refreshes a single row
+  uint32_t cycleMillis = ticks * DRAM_ROWS * 2 / (TICKS_PER_MICROSECOND * 1000);
+  return (cycleMillis > REFRESH_SWEEP_MIN_DWELL_MS) ? cycleMillis : REFRESH_SWEEP_MIN_DWELL_MS;
+}
+
+void RefreshSweep::_setTimerTicks(uint32_t ticks) {
+  // Smallest prescaler that still fits the compare register
+  uint8_t select = 1;
+  while (select < TIMER2_CLOCK_SELECT &&
+         ticks > 256UL * pgm_read_word(&TIMER2_PRESCALERS[select])) {
+    select++;
+  }
+  uint16_t prescaler = pgm_read_word(&TIMER2_PRESCALERS[select]);
+  uint32_t compare = ticks / prescaler;
+
+  uint8_t oldSREG = SREG;
+  cli();
+  TCCR2B = (TCCR2B & ~TIMER2_CLOCK_SELECT) | select;
+  OCR2A = (compare > 0) ? (uint8_t)(compare - 1) : 0;
+  TCNT2 = 0;
+  SREG = oldSREG;
+}
@@ -0,0 +1,93 @@
+#ifndef REFRESH_SWEEP_H
+#define REFRESH_SWEEP_H
+
+#include <Arduino.h>
+
+// Refresh intervals tried, as multiples of the harness default
+#define REFRESH_SWEEP_MAX_STEPS 14
+
+// Shortest hold of the pattern at every step
+#define REFRESH_SWEEP_MIN_DWELL_MS 1000
+
+// Step value of a bit that held at every interval
+#define REFRESH_SWEEP_HELD 0xFF
+
+// Phases of one hold (one pattern at one step)
+#define REFRESH_SWEEP_FILL 0    // Fill a page per step
+#define REFRESH_SWEEP_DWELL 1   // No bus access until the dwell time is over
+#define REFRESH_SWEEP_VERIFY 2  // Verify a page per step
+#define REFRESH_SWEEP_DONE 3
+
+/**
+ * RefreshSweep - Slowest memory refresh each DRAM chip still holds data at
+ *
+ * The harness refreshes DRAM from the Timer2 compare ISR
+ * (Model1.nextUpdate()). This test stretches that interval in steps
+ * (1x, 2x, 3x, ... the default, up to the slowest Timer2 can run) by
+ * reprogramming OCR2A and the prescaler in TCCR2B. At every step DRAM is
+ * filled with 0xFF and then 0x00, left alone long enough for every row to
+ * go through several of the stretched refresh gaps, and verified. Each data
+ * bit is one 4116, so the last step before a bit first fails is that chip's
+ * refresh margin; aging chips lose it long before they fail at the default
+ * rate.
+ *
+ * The dwell assumes the worst case of one row refreshed per interrupt. The
+ * sweep is stepped (begin()/step()), one page or a dwell check per call, so
+ * a console stays responsive; the timer registers are restored when it ends
+ * and by cancel().
+ */
+class RefreshSweep {
+ public:
+  // Sweep a range (TEST signal and bus session active); false if no refresh timer runs
+  static bool begin(uint16_t start, uint16_t length);
+  static void step();
+  static bool isDone();
+  static void cancel();
+
+  // Step of the sweep the next step() works on
+  static uint8_t getStep();
+
+  // Step at which a bit first failed, REFRESH_SWEEP_HELD if it held at every step
+  static uint8_t getBitFailStep(uint8_t bit);
+
+  // Slowest interval a bit held at in microseconds, 0 if it failed at the default
+  static uint32_t getBitHeldMicros(uint8_t bit);
+
+  // Refresh interrupt interval of a step and number of steps of the last run
+  static uint32_t getStepMicros(uint8_t step);
+  static uint8_t getStepCount();
+
+  // Current refresh interrupt interval (0 = timer stopped) and sweep duration
+  static uint32_t getDefaultMicros();
+  static uint32_t getMaxDurationMillis(uint16_t length);
+
+ private:
+  static uint32_t _baseTicks;
+  static uint8_t _stepCount;
+  static uint8_t _failStep[8];
+
+  static uint16_t _start;
+  static uint16_t _length;
+  static uint8_t _steps;        // Steps of this sweep
+  static uint8_t _step;
+  static uint8_t _phase;        // REFRESH_SWEEP_*
+  static uint8_t _pattern;      // 0xFF, then 0x00 at every step
+  static uint8_t _failed;       // Bits that failed at any step so far
+  static uint8_t _bits;         // Bits that failed at this step
+  static uint16_t _offset;      // Page of the fill or verify
+  static uint32_t _dwellMs;
+  static uint32_t _dwellStarted;
+  static uint8_t _savedControl;  // TCCR2B and OCR2A before the sweep
+  static uint8_t _savedCompare;
+
+  static uint32_t _getTimerTicks();
+  static uint32_t _getStepTicks(uint32_t baseTicks, uint8_t step);
+  static uint8_t _getStepCount(uint32_t baseTicks);
+  static uint32_t _getDwellMillis(uint32_t ticks);
+  static void _setTimerTicks(uint32_t ticks);
+  static void _startStep();
+  static void _endHold();
+  static void _restoreTimer();
+};
+
+#endif  // REFRESH_SWEEP_H
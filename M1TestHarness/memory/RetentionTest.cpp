@@ -0,0 +1,204 @@
+#include "./RetentionTest.h"
+
+#include <Arduino.h>
+#include <Model1.h>
+
+#include "./MemoryBus.h"
+
+uint8_t RetentionTest::_bitSteps[8];
+
+uint16_t RetentionTest::_base = 0;
+uint16_t RetentionTest::_rows = 0;
+uint16_t RetentionTest::_stepMs = RETENTION_DEFAULT_STEP_MS;
+uint8_t RetentionTest::_round = RETENTION_ROUNDS;
+uint8_t RetentionTest::_pattern = 0xFF;
+uint8_t RetentionTest::_phase = RETENTION_PHASE_DONE;
+uint16_t RetentionTest::_cursor = 0;
+uint16_t RetentionTest::_remaining = 0;
+uint32_t RetentionTest::_started = 0;
+uint32_t RetentionTest::_spacing = 0;
+
+// Per-row state in the bus scratch: hold steps found so far, rows latched in
+// this hold and rows that failed either pattern of the round
+#define ROW_FLAGS_SIZE (RETENTION_MAX_ROWS / 8)
+static_assert(RETENTION_MAX_ROWS + 2 * ROW_FLAGS_SIZE <= MEMORY_SCRATCH_SIZE,
+              "Row state must fit the scratch");
+
+static uint8_t *rowSteps() {
+  return MemoryBus.getScratch();
+}
+
+static uint8_t *latchedRows() {
+  return MemoryBus.getScratch() + RETENTION_MAX_ROWS;
+}
+
+static uint8_t *failedRows() {
+  return MemoryBus.getScratch() + RETENTION_MAX_ROWS + ROW_FLAGS_SIZE;
+}
+
+#define ROW_FLAG(flags, row) ((flags)[(row) >> 3] & (1 << ((row) & 0x07)))
+#define SET_ROW_FLAG(flags, row) ((flags)[(row) >> 3] |= (1 << ((row) & 0x07)))
+
+// Address of column 0 of a row counted across banks
+static uint16_t rowAddress(uint16_t base, uint16_t row) {
+  return DramTopology::getAddress(base, row / DRAM_ROWS, row % DRAM_ROWS, 0);
+}
+
+void RetentionTest::begin(uint16_t base, uint8_t banks, uint16_t stepMs) {
+  if (banks > RETENTION_MAX_BANKS) {
+    banks = RETENTION_MAX_BANKS;
+  }
+  _base = base;
+  _rows = (uint16_t)banks * DRAM_ROWS;
+  _stepMs = stepMs;
+
+  memset(rowSteps(), 0, RETENTION_MAX_ROWS);
+  memset(_bitSteps, RETENTION_MAX_STEPS, sizeof(_bitSteps));
+  memset(failedRows(), 0, ROW_FLAGS_SIZE);
+
+  // Determine the hold time of every row one bit per round, MSB first
+  _round = 0;
+  _pattern = 0xFF;
+  _phase = (_rows > 0) ? RETENTION_PHASE_FILL : RETENTION_PHASE_DONE;
+  _cursor = 0;
+}
+
+void RetentionTest::step() {
+  switch (_phase) {
+    case RETENTION_PHASE_FILL: {
+      // Fill with refresh still running
+      uint16_t pages = (uint32_t)_rows * DRAM_COLUMNS / MEMORY_PAGE_SIZE;
+      MemoryBus.fillPage(_base + _cursor * MEMORY_PAGE_SIZE, _pattern, MEMORY_PAGE_SIZE);
+      if (++_cursor >= pages) {
+        _startHold();
+      }
+      break;
+    }
+    case RETENTION_PHASE_HOLD:
+      _latchPass();
+      break;
+    case RETENTION_PHASE_VERIFY:
+      _verifyRow();
+      break;
+  }
+}
+
+bool RetentionTest::isDone() {
+  return _phase == RETENTION_PHASE_DONE;
+}
+
+void RetentionTest::cancel() {
+  if (_phase == RETENTION_PHASE_HOLD) {
+    Model1.activateMemoryRefresh();
+  }
+  _phase = RETENTION_PHASE_DONE;
+}
+
+uint8_t RetentionTest::getRound() {
+  return _round;
+}
+
+void RetentionTest::_startHold() {
+  // One access per row starts its hold; row n starts n * spacing after the first
+  Model1.deactivateMemoryRefresh();
+  uint8_t value;
+  _started = micros();
+  for (uint16_t row = 0; row < _rows; row++) {
+    MemoryBus.readPage(rowAddress(_base, row), &value, 1);
+  }
+  _spacing = (micros() - _started) / _rows;
+
+  memset(latchedRows(), 0, ROW_FLAGS_SIZE);
+  _remaining = _rows;
+  _phase = RETENTION_PHASE_HOLD;
+}
+
+void RetentionTest::_latchPass() {
+  // Latch every row when its own candidate hold has elapsed. Latched rows are
+  // touched on every pass from then on, which refreshes only them.
+  uint8_t bit = 0x80 >> _round;
+  uint8_t *steps = rowSteps();
+  uint8_t *latched = latchedRows();
+  uint8_t value;
+  uint32_t elapsed = micros() - _started;
+  for (uint16_t row = 0; row < _rows; row++) {
+    if (!ROW_FLAG(latched, row)) {
+      uint32_t hold = (uint32_t)(steps[row] | bit) * _stepMs * 1000;
+      if (elapsed < row * _spacing + hold) {
+        continue;
+      }
+      SET_ROW_FLAG(latched, row);
+      _remaining--;
+    }
+    MemoryBus.readPage(rowAddress(_base, row), &value, 1);
+  }
+
+  if (_remaining == 0) {
+    Model1.activateMemoryRefresh();
+    _cursor = 0;
+    _phase = RETENTION_PHASE_VERIFY;
+  }
+}
+
+void RetentionTest::_verifyRow() {
+  // Verify with a row burst; the latched state no longer changes
+  uint16_t row = _cursor;
+  uint8_t rowBuffer[DRAM_COLUMNS];
+  MemoryOperation read = {0, _pattern, 0x00, 0x00, 0};
+  MemoryBus.sequenceStride(rowAddress(_base, row), DRAM_ROWS, DRAM_COLUMNS, &read, 1,
+                           rowBuffer);
+
+  uint8_t diff = 0;
+  for (uint8_t column = 0; column < DRAM_COLUMNS; column++) {
+    diff |= rowBuffer[column] ^ _pattern;
+  }
+  if (diff != 0) {
+    SET_ROW_FLAG(failedRows(), row);
+    uint8_t candidate = rowSteps()[row] | (0x80 >> _round);
+    for (uint8_t b = 0; b < 8; b++) {
+      if ((diff & (1 << b)) && candidate < _bitSteps[b]) {
+        _bitSteps[b] = candidate;
+      }
+    }
+  }
+
+  if (++_cursor >= _rows) {
+    _endProbe();
+  }
+}
+
+void RetentionTest::_endProbe() {
+  _cursor = 0;
+  _phase = RETENTION_PHASE_FILL;
+  if (_pattern == 0xFF) {
+    _pattern = 0x00;
+    return;
+  }
+
+  // Both patterns held: the row survives this round's candidate hold
+  uint8_t bit = 0x80 >> _round;
+  uint8_t *steps = rowSteps();
+  uint8_t *failed = failedRows();
+  for (uint16_t row = 0; row < _rows; row++) {
+    if (!ROW_FLAG(failed, row)) {
+      steps[row] |= bit;
+    }
+  }
+  memset(failed, 0, ROW_FLAGS_SIZE);
+  _pattern = 0xFF;
+  if (++_round >= RETENTION_ROUNDS) {
+    _phase = RETENTION_PHASE_DONE;
+  }
+}
+
+uint8_t RetentionTest::getSteps(uint8_t bank, uint8_t row) {
+  return rowSteps()[(uint16_t)bank * DRAM_ROWS + row];
+}
+
+uint8_t RetentionTest::getBitSteps(uint8_t bit) {
+  return _bitSteps[bit & 0x07];
+}
+
+uint32_t RetentionTest::getMaxDurationMillis(uint16_t stepMs) {
+  return (uint32_t)RETENTION_ROUNDS * 2 * RETENTION_MAX_STEPS * stepMs;
+}
@@ -0,0 +1,85 @@
+#ifndef RETENTION_TEST_H
+#define RETENTION_TEST_H
+
+#include <Arduino.h>
+
+#include "./DramTopology.h"
+
+// Hold times are searched in steps of stepMs; 8 bits per row
+#define RETENTION_DEFAULT_STEP_MS 16
+#define RETENTION_MAX_STEPS 255
+#define RETENTION_ROUNDS 8
+
+#define RETENTION_MAX_BANKS 3
+#define RETENTION_MAX_ROWS (DRAM_ROWS * RETENTION_MAX_BANKS)
+
+// Phases of one probe (one pattern of one round)
+#define RETENTION_PHASE_FILL 0    // Fill a page per step, refresh on
+#define RETENTION_PHASE_HOLD 1    // Refresh off, one latch pass per step
+#define RETENTION_PHASE_VERIFY 2  // Refresh on, one row per step
+#define RETENTION_PHASE_DONE 3
+
+/**
+ * RetentionTest - Per-row DRAM retention time with memory refresh disabled
+ *
+ * Every 4116 row is refreshed whenever any of its cells is accessed, so the
+ * retention time of a row is the longest gap between two accesses it
+ * survives. The measurement turns off the harness refresh and searches that
+ * gap for every row at once:
+ *
+ * - Rounds determine the hold time bit by bit (binary search, MSB first), so
+ *   only one byte of state is kept per row
+ * - A round fills DRAM, touches every row once (the start of its hold), and
+ *   then touches each row again exactly when its own candidate hold time has
+ *   elapsed; that access latches the row's state
+ * - Latched rows are verified afterwards with row bursts, so the verify time
+ *   never adds to the measured hold
+ * - Every round is done with 0xFF and 0x00 so both cell polarities decay
+ *
+ * The run time is bounded by RETENTION_ROUNDS * 2 * RETENTION_MAX_STEPS *
+ * stepMs. The measurement is stepped (begin()/step()): a fill page, one
+ * latch pass over the rows or one verified row per call, so a console can
+ * cancel() it at any time, which turns refresh back on at once.
+ */
+class RetentionTest {
+ public:
+  // Measure all rows of banks starting at base (TEST signal and bus session active)
+  static void begin(uint16_t base, uint8_t banks, uint16_t stepMs);
+  static void step();
+  static bool isDone();
+  static void cancel();
+
+  // Round of the binary search the next step works on (RETENTION_ROUNDS when done)
+  static uint8_t getRound();
+
+  // Hold steps a row survived (RETENTION_MAX_STEPS = at least the maximum); kept
+  // in the bus scratch, so only valid until the next test runs
+  static uint8_t getSteps(uint8_t bank, uint8_t row);
+
+  // Shortest hold (steps) at which a data bit failed, RETENTION_MAX_STEPS if never
+  static uint8_t getBitSteps(uint8_t bit);
+
+  // Upper bound of the measurement time
+  static uint32_t getMaxDurationMillis(uint16_t stepMs);
+
+ private:
+  static uint8_t _bitSteps[8];
+
+  static uint16_t _base;
+  static uint16_t _rows;
+  static uint16_t _stepMs;
+  static uint8_t _round;
+  static uint8_t _pattern;   // 0xFF, then 0x00 in every round
+  static uint8_t _phase;     // RETENTION_PHASE_*
+  static uint16_t _cursor;   // Fill page or verified row
+  static uint16_t _remaining;  // Rows not latched yet
+  static uint32_t _started;  // micros() of the first row's hold
+  static uint32_t _spacing;  // Hold start of row n is n * _spacing after _started
+
+  static void _startHold();
+  static void _latchPass();
+  static void _verifyRow();
+  static void _endProbe();
+};
+
+#endif  // RETENTION_TEST_H
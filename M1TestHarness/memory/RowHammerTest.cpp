@@ -0,0 +1,85 @@
+#include "./RowHammerTest.h"
+
+#include <Arduino.h>
+
+#include "./FaultLog.h"
+#include "./MarchTest.h"
+#include "./MemoryBus.h"
+
+void RowHammerTest::_writeRow(uint16_t base, uint8_t bank, uint8_t row, uint8_t value,
+                              TestResult &result) {
+  MarchSweep sweep = {};
+  sweep.ops[0] = {1, value, 0x00, 0x00, 0};
+  sweep.opCount = 1;
+  MarchTest::runLine(sweep, DramTopology::getAddress(base, bank, row, 0), DRAM_ROWS,
+                     DRAM_COLUMNS, result);
+}
+
+void RowHammerTest::run(uint16_t base, uint8_t banks, uint32_t count, uint8_t pattern,
+                        RowHammerResult &result, Print *progress) {
+  result = {};
+  uint8_t victim = ~pattern;
+  FaultLog.setSource(FAULT_TEST_ROW_HAMMER, 0);
+
+  MarchSweep verify = {};
+  verify.ops[0] = {0, victim, 0x00, 0x00, 0};
+  verify.opCount = 1;
+
+  for (uint8_t bank = 0; bank < banks; bank++) {
+    uint32_t length = DRAM_BANK_SIZE;
+    uint16_t bankStart = DramTopology::getAddress(base, bank, 0, 0);
+    for (uint32_t offset = 0; offset < length; offset += MEMORY_PAGE_SIZE) {
+      MemoryBus.fillPage(bankStart + offset, victim, MEMORY_PAGE_SIZE);
+    }
+
+    for (uint8_t row = 0; row < DRAM_ROWS; row++) {
+      if (progress && (row & 0x1F) == 0) {
+        progress->print(F("."));
+      }
+
+      // Edge rows only have one neighbour, which is then hammered on its own
+      uint8_t above = (row > 0) ? row - 1 : row + 1;
+      uint8_t below = (row + 1 < DRAM_ROWS) ? row + 1 : row - 1;
+      _writeRow(base, bank, above, pattern, result.result);
+      _writeRow(base, bank, below, pattern, result.result);
+
+      uint16_t first = DramTopology::getAddress(base, bank, above, 0);
+      uint16_t second = DramTopology::getAddress(base, bank, below, 0);
+      for (uint32_t done = 0; done < count;) {
+        uint32_t pairs = count - done;
+        if (pairs > ROW_HAMMER_MAX_PAIRS) {
+          pairs = ROW_HAMMER_MAX_PAIRS;
+        }
+        result.hammerMicros += MemoryBus.hammer(first, second, pairs);
+        result.activations += pairs * 2;
+        done += pairs;
+      }
+
+      _writeRow(base, bank, above, victim, result.result);
+      _writeRow(base, bank, below, victim, result.result);
+
+      uint32_t errors = result.result.totalErrors;
+      MarchTest::runLine(verify, DramTopology::getAddress(base, bank, row, 0), DRAM_ROWS,
+                         DRAM_COLUMNS, result.result);
+      result.victimRows++;
+      if (result.result.totalErrors != errors) {
+        result.flippedRows++;
+      }
+    }
+  }
+
+  if (progress) {
+    progress->println();
+  }
+}
+
+uint32_t RowHammerTest::getActivationsPerSecond(const RowHammerResult &result) {
+  if (result.hammerMicros == 0) {
+    return 0;
+  }
+  return (uint32_t)((uint64_t)result.activations * 1000000 / result.hammerMicros);
+}
+
+uint32_t RowHammerTest::getActivations(uint8_t banks, uint32_t count) {
+  return (uint32_t)banks * DRAM_ROWS * count * 2;
+}
@@ -0,0 +1,54 @@
+#ifndef ROW_HAMMER_TEST_H
+#define ROW_HAMMER_TEST_H
+
+#include <Arduino.h>
+
+#include "./DramTopology.h"
+#include "./TestResult.h"
+
+// Activations of each aggressor row per victim row
+#define ROW_HAMMER_DEFAULT_COUNT 20000UL
+#define ROW_HAMMER_MAX_PAIRS 0xFFFF  // Per MemoryBus.hammer() call
+
+// Aggressor data; the victim rows hold the inverse
+#define ROW_HAMMER_DEFAULT_PATTERN 0xFF
+
+struct RowHammerResult {
+  TestResult result;       // Victim bit flips
+  uint32_t activations;    // Row activations done by hammering
+  uint32_t hammerMicros;   // Time spent hammering
+  uint16_t victimRows;     // Rows checked
+  uint16_t flippedRows;    // Rows with at least one flip
+};
+
+/**
+ * RowHammerTest - Read-disturb stress of the DRAM rows
+ *
+ * The Model I does a full RAS/CAS cycle on every access, so each read
+ * activates the row of its address (A0-A6). For every victim row of a bank:
+ * - The neighbouring rows above and below (the aggressors) are written with
+ *   the pattern, everything else holds its inverse
+ * - The aggressors are read alternately count times each with the tightest
+ *   loop the bus allows (MemoryBus.hammer()); refresh keeps running
+ * - The aggressors are restored and the victim row is verified
+ *
+ * Flips are counted per data bit (chip) and go to FaultLog. The achieved
+ * activation rate is measured over the hammer loops only.
+ */
+class RowHammerTest {
+ public:
+  // Hammer all rows of banks starting at base (TEST signal and bus session active)
+  static void run(uint16_t base, uint8_t banks, uint32_t count, uint8_t pattern,
+                  RowHammerResult &result, Print *progress = nullptr);
+
+  static uint32_t getActivationsPerSecond(const RowHammerResult &result);
+
+  // Activations a run does
+  static uint32_t getActivations(uint8_t banks, uint32_t count);
+
+ private:
+  static void _writeRow(uint16_t base, uint8_t bank, uint8_t row, uint8_t value,
+                        TestResult &result);
+};
+
+#endif  // ROW_HAMMER_TEST_H
@@ -0,0 +1,77 @@
+#include "./SoakStats.h"
+
+#include <Arduino.h>
+
+SoakStats::SoakStats() {
+  begin();
+}
+
+void SoakStats::begin() {
+  _totalErrors = 0;
+  _passes = 0;
+  _historyHead = 0;
+  memset(_bitErrors, 0, sizeof(_bitErrors));
+  memset(_failedPasses, 0, sizeof(_failedPasses));
+  memset(_firstFailedPass, 0, sizeof(_firstFailedPass));
+  memset(_history, 0, sizeof(_history));
+}
+
+void SoakStats::addPass(const TestResult &pass) {
+  _historyHead = (_historyHead + 1) % SOAK_HISTORY;
+  _totalErrors += pass.totalErrors;
+
+  for (uint8_t b = 0; b < 8; b++) {
+    uint32_t errors = pass.bitErrors[b];
+    _history[_historyHead][b] = errors > 0xFF ? 0xFF : errors;
+    if (errors == 0) {
+      continue;
+    }
+    if (_failedPasses[b] == 0) {
+      _firstFailedPass[b] = _passes;
+    }
+    _bitErrors[b] += errors;
+    _failedPasses[b]++;
+  }
+  _passes++;
+}
+
+uint16_t SoakStats::getPasses() const {
+  return _passes;
+}
+
+uint32_t SoakStats::getErrors(uint8_t bit) const {
+  return _bitErrors[bit & 0x07];
+}
+
+uint16_t SoakStats::getFailedPasses(uint8_t bit) const {
+  return _failedPasses[bit & 0x07];
+}
+
+uint8_t SoakStats::getState(uint8_t bit) const {
+  bit &= 0x07;
+  if (_failedPasses[bit] == 0) {
+    return SOAK_BIT_CLEAN;
+  }
+  uint16_t since = _passes - _firstFailedPass[bit];
+  return (_failedPasses[bit] == since) ? SOAK_BIT_SOLID : SOAK_BIT_INTERMITTENT;
+}
+
+void SoakStats::getTotal(TestResult &total) const {
+  total.totalErrors = _totalErrors;
+  memcpy(total.bitErrors, _bitErrors, sizeof(total.bitErrors));
+}
+
+uint32_t SoakStats::getErrorsPerHour(uint8_t bit, uint32_t elapsedMs) const {
+  if (elapsedMs == 0) {
+    return 0;
+  }
+  return (uint32_t)((uint64_t)_bitErrors[bit & 0x07] * 3600000UL / elapsedMs);
+}
+
+uint8_t SoakStats::getPassErrors(uint8_t passesAgo, uint8_t bit) const {
+  if (passesAgo >= SOAK_HISTORY || passesAgo >= _passes) {
+    return 0;
+  }
+  uint8_t slot = (_historyHead + SOAK_HISTORY - passesAgo) % SOAK_HISTORY;
+  return _history[slot][bit & 0x07];
+}
@@ -0,0 +1,60 @@
+#ifndef SOAK_STATS_H
+#define SOAK_STATS_H
+
+#include <Arduino.h>
+
+#include "./TestResult.h"
+
+// Passes kept with their per-bit counts (ring, newest first)
+#define SOAK_HISTORY 8
+
+// Behaviour of one data bit (chip) over the soak
+#define SOAK_BIT_CLEAN 0         // Never failed
+#define SOAK_BIT_SOLID 1         // Failed every pass since it first failed
+#define SOAK_BIT_INTERMITTENT 2  // Failed in some passes after its first failure, not in others
+
+/**
+ * SoakStats - Fixed-size statistics of a suite looped for hours
+ *
+ * A soak runs the same tests pass after pass; keeping every pass is not
+ * possible in SRAM, so only what tells intermittent faults apart is kept, at
+ * a constant ~130 bytes whatever the duration:
+ * - Total errors and the number of failing passes per bit
+ * - The pass each bit first failed in, so a fault that appears (e.g. when the
+ *   board is warm) and then stays is not taken as intermittent
+ * - Saturating per-bit counts of the last SOAK_HISTORY passes
+ */
+class SoakStats {
+ public:
+  SoakStats();
+
+  void begin();
+
+  // Account the result of one complete pass
+  void addPass(const TestResult &pass);
+
+  uint16_t getPasses() const;
+  uint32_t getErrors(uint8_t bit) const;
+  uint16_t getFailedPasses(uint8_t bit) const;
+  uint8_t getState(uint8_t bit) const;  // SOAK_BIT_*
+
+  // Sum of all passes as one result
+  void getTotal(TestResult &total) const;
+
+  // Errors per hour of a bit over elapsedMs of soak time
+  uint32_t getErrorsPerHour(uint8_t bit, uint32_t elapsedMs) const;
+
+  // Errors of a bit in a recent pass (0 = last pass), saturated at 255
+  uint8_t getPassErrors(uint8_t passesAgo, uint8_t bit) const;
+
+ private:
+  uint32_t _totalErrors;
+  uint32_t _bitErrors[8];
+  uint16_t _failedPasses[8];
+  uint16_t _firstFailedPass[8];
+  uint16_t _passes;
+  uint8_t _history[SOAK_HISTORY][8];
+  uint8_t _historyHead;  // Slot of the last pass
+};
+
+#endif  // SOAK_STATS_H
@@ -0,0 +1,100 @@
+#include "./SuiteComposition.h"
+
+#include <Arduino.h>
+#include <EEPROM.h>
+
+void SuiteComposition::setDefaults() {
+  magic = SUITE_COMPOSITION_MAGIC;
+  testMask = SUITE_ALL_TESTS;
+  memset(repeats, 0, sizeof(repeats));
+  startKB = 0;
+  lengthKB = 0;
+  npsf = false;
+  checksum = _getChecksum();
+}
+
+bool SuiteComposition::load() {
+  EEPROM.get(SUITE_COMPOSITION_EEPROM_ADDRESS, *this);
+  if (magic != SUITE_COMPOSITION_MAGIC || checksum != _getChecksum()) {
+    setDefaults();
+    return false;
+  }
+  return true;
+}
+
+void SuiteComposition::save() {
+  magic = SUITE_COMPOSITION_MAGIC;
+  checksum = _getChecksum();
+
+  // put() only writes the bytes that differ, sparing EEPROM cycles
+  EEPROM.put(SUITE_COMPOSITION_EEPROM_ADDRESS, *this);
+}
+
+uint8_t SuiteComposition::getRuns(uint8_t testNumber) const {
+  if (testNumber >= SUITE_COMPOSITION_MAX_TESTS || !(testMask & (1UL << testNumber))) {
+    return 0;
+  }
+  return ((repeats[testNumber >> 2] >> ((testNumber & 0x03) * 2)) & 0x03) + 1;
+}
+
+void SuiteComposition::setRuns(uint8_t testNumber, uint8_t runs) {
+  if (testNumber >= SUITE_COMPOSITION_MAX_TESTS) {
+    return;
+  }
+  if (runs > SUITE_COMPOSITION_MAX_REPEATS) {
+    runs = SUITE_COMPOSITION_MAX_REPEATS;
+  }
+
+  uint8_t shift = (testNumber & 0x03) * 2;
+  repeats[testNumber >> 2] &= ~(0x03 << shift);
+  if (runs == 0) {
+    testMask &= ~(1UL << testNumber);
+    return;
+  }
+  testMask |= 1UL << testNumber;
+  repeats[testNumber >> 2] |= (runs - 1) << shift;
+}
+
+uint8_t SuiteComposition::getPassCount() const {
+  uint8_t passes = 0;
+  for (uint8_t n = 0; n < SUITE_COMPOSITION_MAX_TESTS; n++) {
+    uint8_t runs = getRuns(n);
+    if (runs > passes) {
+      passes = runs;
+    }
+  }
+  return passes;
+}
+
+uint32_t SuiteComposition::getPassMask(uint8_t pass) const {
+  uint32_t mask = 0;
+  for (uint8_t n = 0; n < SUITE_COMPOSITION_MAX_TESTS; n++) {
+    if (getRuns(n) > pass) {
+      mask |= 1UL << n;
+    }
+  }
+  return mask;
+}
+
+uint16_t SuiteComposition::getStart(uint16_t dramStart) const {
+  return dramStart + (uint16_t)startKB * 1024;
+}
+
+uint16_t SuiteComposition::getLength(uint16_t sizeKB) const {
+  if (startKB >= sizeKB) {
+    return 0;
+  }
+  uint16_t available = sizeKB - startKB;
+  uint16_t kb = (lengthKB == 0 || lengthKB > available) ? available : lengthKB;
+  return kb * 1024;
+}
+
+uint8_t SuiteComposition::_getChecksum() const {
+  // Sum of every byte before the checksum, seeded so all zeros is invalid
+  const uint8_t *bytes = (const uint8_t *)this;
+  uint8_t sum = 0xA5;
+  for (uint8_t i = 0; i < offsetof(SuiteComposition, checksum); i++) {
+    sum += bytes[i];
+  }
+  return sum;
+}
@@ -0,0 +1,63 @@
+#ifndef SUITE_COMPOSITION_H
+#define SUITE_COMPOSITION_H
+
+#include <Arduino.h>
+
+#include "./TestSuite.h"
+
+// EEPROM location of the stored composition
+#define SUITE_COMPOSITION_EEPROM_ADDRESS 0
+#define SUITE_COMPOSITION_MAGIC 0x5343  // "SC"
+
+// Titled tests a composition can hold, and runs per test
+#define SUITE_COMPOSITION_MAX_TESTS 32
+#define SUITE_COMPOSITION_MAX_REPEATS 4
+
+// Range granularity: the start is a whole bank, the length a multiple of 4KB
+#define SUITE_COMPOSITION_START_STEP_KB 16
+#define SUITE_COMPOSITION_LENGTH_STEP_KB 4
+
+/**
+ * SuiteComposition - A custom selection of the RAM test suite
+ *
+ * testMask picks titled tests by number (as SweepScheduler::setTestMask);
+ * the repeat count of every test is packed into two bits (1 to 4 runs). A
+ * composition runs as passes of the suite: pass n runs the selected tests
+ * that still have runs left, so all repeats share one TEST activation and
+ * keep the suite order within a pass.
+ *
+ * Stored in EEPROM with a magic and checksum; anything else loads the
+ * defaults (whole suite once, whole DRAM).
+ */
+struct SuiteComposition {
+  uint16_t magic;
+  uint32_t testMask;                                         // Titled tests to run
+  uint8_t repeats[SUITE_COMPOSITION_MAX_TESTS / 4];          // 2 bits per test: runs - 1
+  uint8_t startKB;                                           // Offset into DRAM
+  uint8_t lengthKB;                                          // 0 = to the end of DRAM
+  bool npsf;                                                 // NPSF test after the suite
+  uint8_t checksum;
+
+  void setDefaults();
+
+  // Load from EEPROM (defaults if nothing valid is stored), save only what changed
+  bool load();
+  void save();
+
+  // Runs of a titled test, 0 = not selected
+  uint8_t getRuns(uint8_t testNumber) const;
+  void setRuns(uint8_t testNumber, uint8_t runs);
+
+  // Passes the composition takes and the tests of a pass
+  uint8_t getPassCount() const;
+  uint32_t getPassMask(uint8_t pass) const;
+
+  // Range within DRAM of sizeKB, clamped to it
+  uint16_t getStart(uint16_t dramStart) const;
+  uint16_t getLength(uint16_t sizeKB) const;
+
+ private:
+  uint8_t _getChecksum() const;
+};
+
+#endif  // SUITE_COMPOSITION_H
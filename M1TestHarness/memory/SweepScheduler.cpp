@@ -0,0 +1,265 @@
+#include "./SweepScheduler.h"
+
+#include <Arduino.h>
+
+#include "./FaultLog.h"
+
+static bool isWriteOnly(const MarchSweep &sweep) {
+  if (sweep.opCount == 0) {
+    return false;
+  }
+  for (uint8_t k = 0; k < sweep.opCount; k++) {
+    if (!sweep.ops[k].write) {
+      return false;
+    }
+  }
+  return true;
+}
+
+SweepScheduler::SweepScheduler() {
+  _tests = nullptr;
+  _seed = 0;
+  _testCount = 0;
+  _testIndex = 0;
+  _passActive = false;
+  _delaying = false;
+  _replaySeed = 0;
+  _replayStride = RANDOM_PATTERN_DEFAULT_STRIDE;
+  _testMask = SUITE_ALL_TESTS;
+}
+
+void SweepScheduler::begin(const SuiteTest *tests, uint8_t testCount, uint16_t start,
+                           uint16_t length, bool fuse, uint32_t delayMs) {
+  _tests = tests;
+  _testCount = testCount;
+  _start = start;
+  _length = length;
+  _fuse = fuse;
+  _delayMs = delayMs;
+
+  _testIndex = 0;
+  _elementIndex = 0;
+  _testNumber = 0xFF;  // The first titled test becomes 0
+  _contentValid = false;
+  _passActive = false;
+  _delaying = false;
+
+  _sweeps = 0;
+  _naiveSweeps = 0;
+  _operations = 0;
+  _naiveOperations = 0;
+
+  _enterTest();
+}
+
+void SweepScheduler::step(TestResult &result, uint16_t maxCells) {
+  if (_delaying) {
+    if (millis() - _delayStarted < _delayMs) {
+      return;
+    }
+    _delaying = false;
+  }
+  if (!_passActive && !_beginPass()) {
+    return;
+  }
+
+  // Descending passes are sliced from the top of the range down
+  uint16_t remaining = _length - _passOffset;
+  uint16_t cells = (maxCells == 0 || maxCells > remaining) ? remaining : maxCells;
+  uint16_t offset = _pass.descending ? (remaining - cells) : _passOffset;
+  uint32_t errors = result.totalErrors;
+  MarchTest::runSweep(_pass, _start + offset, cells, result);
+
+  // Failing cells may not hold the assumed content; the next fill must run
+  if (result.totalErrors != errors) {
+    _contentValid = false;
+  }
+
+  _passOffset += cells;
+  if (_passOffset >= _length) {
+    _passActive = false;
+  }
+}
+
+void SweepScheduler::setTestMask(uint32_t mask) {
+  _testMask = mask;
+}
+
+void SweepScheduler::setSeed(uint16_t seed, uint16_t stride) {
+  _replaySeed = seed;
+  _replayStride = stride;
+}
+
+bool SweepScheduler::isDone() const {
+  return _isCursorDone() && !isInPass();
+}
+
+bool SweepScheduler::isInPass() const {
+  return _passActive || _delaying;
+}
+
+uint8_t SweepScheduler::getTest() const {
+  return _passActive ? _passTest : _testIndex;
+}
+
+uint8_t SweepScheduler::getTestNumber() const {
+  return _testNumber;
+}
+
+const __FlashStringHelper *SweepScheduler::getTitle() const {
+  return (const __FlashStringHelper *)_test.title;
+}
+
+uint8_t SweepScheduler::getPattern() const {
+  return _pattern;
+}
+
+uint16_t SweepScheduler::getSeed() const {
+  return _seed;
+}
+
+uint8_t SweepScheduler::getFlags() const {
+  return _test.flags;
+}
+
+uint16_t SweepScheduler::getSweeps() const {
+  return _sweeps;
+}
+
+uint16_t SweepScheduler::getNaiveSweeps() const {
+  return _naiveSweeps;
+}
+
+uint32_t SweepScheduler::getOperations() const {
+  return _operations;
+}
+
+uint32_t SweepScheduler::getNaiveOperations() const {
+  return _naiveOperations;
+}
+
+bool SweepScheduler::_isCursorDone() const {
+  return _testIndex >= _testCount;
+}
+
+bool SweepScheduler::_beginPass() {
+  MarchSweep &sweep = _pass;
+
+  // A fill that would rewrite what memory already holds is not needed
+  while (_fuse && !_isCursorDone()) {
+    _decode(sweep);
+    if (!_contentValid || !_isRedundantWrite(sweep, _content)) {
+      break;
+    }
+    _advance(sweep);
+  }
+  if (_isCursorDone()) {
+    return false;
+  }
+
+  _decode(sweep);
+  FaultLog.setSource(_testNumber, _elementIndex);
+  _passTest = _testIndex;
+  _advance(sweep);
+  if (sweep.opCount == 0) {
+    _delaying = true;
+    _delayStarted = millis();
+    return false;
+  }
+
+  // Pull the following write-only elements into this pass
+  while (_fuse && !_isCursorDone()) {
+    MarchSweep next;
+    _decode(next);
+    if (!isWriteOnly(next)) {
+      break;
+    }
+    // Only after a write of this pass: a read may find the cell upset
+    const MemoryOperation &last = sweep.ops[sweep.opCount - 1];
+    if (last.write && _isRedundantWrite(next, last)) {
+      _advance(next);
+      continue;
+    }
+    if (sweep.opCount + next.opCount > MARCH_MAX_OPS) {
+      break;
+    }
+    for (uint8_t k = 0; k < next.opCount; k++) {
+      sweep.ops[sweep.opCount++] = next.ops[k];
+    }
+    _advance(next);
+  }
+
+  _sweeps++;
+  _operations += (uint32_t)sweep.opCount * _length;
+  _content = sweep.ops[sweep.opCount - 1];
+  _contentValid = true;
+
+  _passOffset = 0;
+  _passActive = true;
+  return true;
+}
+
+void SweepScheduler::_enterTest() {
+  // Masked tests are skipped with their continuation entries; numbers stay the same
+  while (!_isCursorDone()) {
+    memcpy_P(&_test, &_tests[_testIndex], sizeof(_test));
+    if (_test.title) {
+      _testNumber++;
+    }
+    if (_testNumber >= 32 || (_testMask & (1UL << _testNumber))) {
+      break;
+    }
+    _testIndex++;
+  }
+  if (_isCursorDone()) {
+    return;
+  }
+  _pattern = _test.pattern;
+  _seed = 0;
+  if (_test.flags & SUITE_RANDOM_PATTERN) {
+    if (_replaySeed) {
+      _seed = _replaySeed;
+      _replaySeed = RandomPattern::getSeed(_replaySeed, 1, _replayStride);
+    } else {
+      _seed = RandomPattern::newSeed();
+    }
+  }
+}
+
+void SweepScheduler::_decode(MarchSweep &sweep) const {
+  uint16_t element = pgm_read_word(&_test.elements[_elementIndex]);
+  MarchTest::decodeElement(element, _pattern, _test.data, sweep, _seed);
+
+  if (_test.flags & SUITE_READ_ONCE) {
+    for (uint8_t k = 0; k < sweep.opCount; k++) {
+      if (!sweep.ops[k].write) {
+        sweep.onceMask |= (1 << k);
+      }
+    }
+  }
+}
+
+void SweepScheduler::_advance(const MarchSweep &sweep) {
+  // Every element counts as one pass of the naive order, whether run, fused or dropped
+  if (sweep.opCount > 0) {
+    _naiveSweeps++;
+    _naiveOperations += (uint32_t)sweep.opCount * _length;
+  }
+
+  if (++_elementIndex >= _test.elementCount) {
+    _elementIndex = 0;
+    _testIndex++;
+    _enterTest();
+  }
+}
+
+bool SweepScheduler::_isRedundantWrite(const MarchSweep &sweep,
+                                       const MemoryOperation &content) const {
+  // Only a plain fill; repeated writes are a stress test of their own
+  if (sweep.opCount != 1 || !sweep.ops[0].write) {
+    return false;
+  }
+  const MemoryOperation &op = sweep.ops[0];
+  return op.value == content.value && op.addressMask == content.addressMask &&
+         op.oddMask == content.oddMask && op.seed == content.seed;
+}
@@ -0,0 +1,112 @@
+#ifndef SWEEP_SCHEDULER_H
+#define SWEEP_SCHEDULER_H
+
+#include <Arduino.h>
+
+#include "./MarchTest.h"
+#include "./RandomPattern.h"
+#include "./TestResult.h"
+#include "./TestSuite.h"
+
+/**
+ * SweepScheduler - Runs a list of suite tests with fused sweeps
+ *
+ * Run naively, every element of every test is its own pass over the range.
+ * With fusion enabled the scheduler merges compatible elements across test
+ * boundaries while keeping each test's operations:
+ * - A write-only element is appended to the preceding pass (e.g. the final
+ *   read-verify of one test runs together with the initial fill of the next)
+ * - A single fill with the value memory already holds is dropped entirely,
+ *   unless the pass before it found errors (the failing cells may hold
+ *   anything, so the next test starts from a clean fill as in the naive order)
+ *
+ * Failures are attributed in FaultLog to the test and element the pass started
+ * with; fused passes only ever add writes, so every read belongs to it.
+ *
+ * The scheduler is stepped in bounded slices of a pass so callers can keep
+ * the UI responsive (see RAMTestSuiteConsole); delays between elements do not
+ * block but end on a later step. The naive and the fused sweep/operation
+ * counts are kept for reporting the savings. A test mask restricts the run to
+ * a subset of the titled tests.
+ */
+class SweepScheduler {
+ public:
+  SweepScheduler();
+
+  void begin(const SuiteTest *tests, uint8_t testCount, uint16_t start, uint16_t length,
+             bool fuse = true, uint32_t delayMs = MARCH_DEFAULT_DELAY_MS);
+
+  // Run only the titled tests whose bit (by test number) is set; kept across begin()
+  void setTestMask(uint32_t mask);
+
+  // Replay: random tests use seed, seed + stride, ... instead of fresh seeds (0 = fresh)
+  void setSeed(uint16_t seed, uint16_t stride = RANDOM_PATTERN_DEFAULT_STRIDE);
+
+  // Run up to maxCells cells of the current pass (0 = the rest of it) and
+  // accumulate its errors into result; starts the next pass or delay if needed
+  void step(TestResult &result, uint16_t maxCells = 0);
+  bool isDone() const;
+
+  // A pass or delay is started but not finished
+  bool isInPass() const;
+
+  // Test the running pass started in, or the next pass starts in
+  uint8_t getTest() const;
+  uint8_t getTestNumber() const;  // Counts titled tests only
+  const __FlashStringHelper *getTitle() const;
+  uint8_t getPattern() const;
+  uint16_t getSeed() const;  // Seed of a SUITE_RANDOM_PATTERN test
+  uint8_t getFlags() const;
+
+  // Passes and bus operations executed, and what the naive order would have needed
+  uint16_t getSweeps() const;
+  uint16_t getNaiveSweeps() const;
+  uint32_t getOperations() const;
+  uint32_t getNaiveOperations() const;
+
+ private:
+  const SuiteTest *_tests;
+  uint8_t _testCount;
+  uint16_t _start;
+  uint16_t _length;
+  bool _fuse;
+  uint32_t _delayMs;
+
+  // Cursor
+  uint8_t _testIndex;
+  uint8_t _elementIndex;
+  SuiteTest _test;  // RAM copy of the test at the cursor
+  uint8_t _pattern;
+  uint16_t _seed;
+  uint16_t _replaySeed;
+  uint16_t _replayStride;
+  uint32_t _testMask;
+  uint8_t _testNumber;
+
+  // What memory holds after the last pass (write flag ignored); invalid once
+  // the pass found errors
+  bool _contentValid;
+  MemoryOperation _content;
+
+  // Pass being sliced
+  MarchSweep _pass;
+  uint8_t _passTest;
+  uint16_t _passOffset;  // Cells done
+  bool _passActive;
+  bool _delaying;
+  uint32_t _delayStarted;
+
+  uint16_t _sweeps;
+  uint16_t _naiveSweeps;
+  uint32_t _operations;
+  uint32_t _naiveOperations;
+
+  bool _isCursorDone() const;
+  bool _beginPass();
+  void _enterTest();
+  void _decode(MarchSweep &sweep) const;
+  void _advance(const MarchSweep &sweep);
+  bool _isRedundantWrite(const MarchSweep &sweep, const MemoryOperation &content) const;
+};
+
+#endif  // SWEEP_SCHEDULER_H
@@ -0,0 +1,171 @@
+#include "./TestPlanner.h"
+
+#include <Arduino.h>
+
+#include "./MarchTest.h"
+#include "./MemoryBus.h"
+#include "./NpsfTest.h"
+
+static const char FAULT_STUCK[] PROGMEM = "stuck-at";
+static const char FAULT_TRANSITION[] PROGMEM = "transition";
+static const char FAULT_COUPLING[] PROGMEM = "coupling";
+static const char FAULT_ADDRESS[] PROGMEM = "address";
+static const char FAULT_DATA[] PROGMEM = "data pattern";
+static const char FAULT_READ_DISTURB[] PROGMEM = "read disturb";
+static const char FAULT_RETENTION[] PROGMEM = "retention";
+static const char FAULT_NPSF[] PROGMEM = "NPSF";
+static const char *const FAULT_NAMES[] PROGMEM = {
+    FAULT_STUCK, FAULT_TRANSITION, FAULT_COUPLING,  FAULT_ADDRESS,
+    FAULT_DATA,  FAULT_READ_DISTURB, FAULT_RETENTION, FAULT_NPSF};
+
+static uint8_t countClasses(uint8_t classes) {
+  uint8_t count = 0;
+  for (; classes; classes &= classes - 1) {
+    count++;
+  }
+  return count;
+}
+
+static uint32_t getMillis(uint32_t operations, uint32_t opsPerSecond) {
+  return (uint32_t)((uint64_t)operations * 1000 / opsPerSecond);
+}
+
+void TestPlanner::plan(uint16_t length, uint32_t budgetMillis, uint32_t opsPerSecond,
+                       TestPlan &plan) {
+  if (opsPerSecond == 0) {
+    opsPerSecond = 1;
+  }
+
+  // Longest range on which the core classes fit; the shortest one otherwise
+  uint16_t planLength = length;
+  while (true) {
+    _plan(planLength, planLength == length, budgetMillis, opsPerSecond, plan);
+    if ((plan.coverage & PLAN_FAULT_CORE) == PLAN_FAULT_CORE || planLength / 2 < PLAN_MIN_LENGTH) {
+      return;
+    }
+    planLength /= 2;
+  }
+}
+
+void TestPlanner::_plan(uint16_t length, bool npsf, uint32_t budgetMillis,
+                        uint32_t opsPerSecond, TestPlan &plan) {
+  uint8_t tests = getSuiteTitledCount(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT);
+
+  plan.testMask = 0;
+  plan.estimatedMillis = 0;
+  plan.length = length;
+  plan.coverage = 0;
+  plan.npsf = false;
+
+  // Candidates 0..tests-1 are suite tests, tests is the NPSF test
+  uint32_t npsfMillis = npsf ? getMillis(NpsfTest::getOperations(length), opsPerSecond) : 0;
+
+  // Most new classes per millisecond first
+  while (true) {
+    uint8_t best = 0xFF;
+    uint8_t bestGain = 0;
+    uint32_t bestMillis = 0;
+    for (uint8_t n = 0; n <= tests; n++) {
+      uint8_t coverage;
+      uint32_t millis;
+      if (n == tests) {
+        if (!npsf || plan.npsf) {
+          continue;
+        }
+        coverage = PLAN_FAULT_NPSF;
+        millis = npsfMillis;
+      } else {
+        if (plan.testMask & (1UL << n)) {
+          continue;
+        }
+        coverage = getTestCoverage(n);
+        millis = getTestMillis(n, length, opsPerSecond);
+      }
+
+      uint8_t gain = countClasses(coverage & ~plan.coverage);
+      if (gain == 0 || plan.estimatedMillis + millis > budgetMillis) {
+        continue;
+      }
+      if (best == 0xFF || (uint32_t)gain * bestMillis > (uint32_t)bestGain * millis) {
+        best = n;
+        bestGain = gain;
+        bestMillis = millis;
+      }
+    }
+    if (best == 0xFF) {
+      break;
+    }
+
+    if (best == tests) {
+      plan.npsf = true;
+      plan.coverage |= PLAN_FAULT_NPSF;
+    } else {
+      plan.testMask |= 1UL << best;
+      plan.coverage |= getTestCoverage(best);
+    }
+    plan.estimatedMillis += bestMillis;
+  }
+
+  // What is left goes to more backgrounds of the same classes
+  for (uint8_t n = 0; n < tests; n++) {
+    if (plan.testMask & (1UL << n)) {
+      continue;
+    }
+    uint32_t millis = getTestMillis(n, length, opsPerSecond);
+    if (plan.estimatedMillis + millis <= budgetMillis) {
+      plan.testMask |= 1UL << n;
+      plan.estimatedMillis += millis;
+    }
+  }
+}
+
+uint32_t TestPlanner::measureOpsPerSecond(uint16_t start) {
+  uint8_t buffer[PLAN_CALIBRATION_CELLS];
+
+  uint32_t started = micros();
+  MemoryBus.readPage(start, buffer, PLAN_CALIBRATION_CELLS);
+  MemoryBus.writePage(start, buffer, PLAN_CALIBRATION_CELLS);
+  uint32_t elapsed = micros() - started;
+  if (elapsed == 0) {
+    return 0;
+  }
+  return (uint32_t)((uint64_t)PLAN_CALIBRATION_CELLS * 2 * 1000000 / elapsed);
+}
+
+uint32_t TestPlanner::getTestMillis(uint8_t testNumber, uint16_t length, uint32_t opsPerSecond) {
+  uint32_t operations = 0;
+  uint32_t delayMillis = 0;
+  uint8_t number = 0xFF;
+  for (uint8_t i = 0; i < RAM_TEST_SUITE_COUNT; i++) {
+    SuiteTest test;
+    memcpy_P(&test, &RAM_TEST_SUITE[i], sizeof(test));
+    if (test.title) {
+      number++;
+    }
+    if (number != testNumber) {
+      continue;
+    }
+
+    operations += (uint32_t)MarchTest::getOperationsPerCell(test.elements, test.elementCount) *
+                  length;
+    for (uint8_t e = 0; e < test.elementCount; e++) {
+      if (MARCH_ELEMENT_COUNT(pgm_read_word(&test.elements[e])) == 0) {
+        delayMillis += MARCH_DEFAULT_DELAY_MS;
+      }
+    }
+  }
+  return getMillis(operations, opsPerSecond ? opsPerSecond : 1) + delayMillis;
+}
+
+uint8_t TestPlanner::getTestCoverage(uint8_t testNumber) {
+  return getSuiteFaults(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, testNumber);
+}
+
+const __FlashStringHelper *TestPlanner::getFaultName(uint8_t fault) {
+  for (uint8_t b = 0; b < 8; b++) {
+    if (fault == (1 << b)) {
+      return (const __FlashStringHelper *)pgm_read_ptr(&FAULT_NAMES[b]);
+    }
+  }
+  return F("?");
+}
@@ -0,0 +1,65 @@
+#ifndef TEST_PLANNER_H
+#define TEST_PLANNER_H
+
+#include <Arduino.h>
+
+#include "./TestSuite.h"
+
+// Classes a plan must cover before the range is allowed to stay whole
+#define PLAN_FAULT_CORE (PLAN_FAULT_STUCK | PLAN_FAULT_TRANSITION | PLAN_FAULT_COUPLING | PLAN_FAULT_ADDRESS)
+
+// Shortest range a plan is cut down to
+#define PLAN_MIN_LENGTH 1024
+
+// Cells read and written back to measure the bus rate
+#define PLAN_CALIBRATION_CELLS 128
+
+// Tests and range chosen for a time budget
+struct TestPlan {
+  uint32_t testMask;         // Titled suite tests to run (SweepScheduler::setTestMask)
+  uint32_t estimatedMillis;  // Run time at the measured bus rate
+  uint16_t length;           // Bytes tested from the start of the range
+  uint8_t coverage;          // PLAN_FAULT_* detected by the chosen tests
+  bool npsf;                 // NPSF test after the suite (whole range only)
+};
+
+/**
+ * TestPlanner - Chooses suite tests and range for a time budget
+ *
+ * Every titled test of RAM_TEST_SUITE has a cost (its bus operations per cell
+ * times the range, plus its delay elements) and the fault classes it detects.
+ * With the bus rate measured on this unit the planner greedily picks the test
+ * that adds the most uncovered classes per millisecond until nothing new
+ * fits, then spends what is left of the budget on the remaining tests in
+ * suite order (more backgrounds, same classes).
+ *
+ * If the core classes (PLAN_FAULT_CORE) do not fit on the whole range, the
+ * range is halved until they do: every byte spans all eight chips, so a
+ * shorter range still tests every IC, only fewer of its cells.
+ *
+ * Estimates ignore fusing (SweepScheduler), so runs finish early rather than
+ * late.
+ */
+class TestPlanner {
+ public:
+  // Best plan for length bytes within budgetMillis at opsPerSecond
+  static void plan(uint16_t length, uint32_t budgetMillis, uint32_t opsPerSecond,
+                   TestPlan &plan);
+
+  // Bus rate of this unit in operations per second; memory content is kept
+  // (TEST signal and bus session active)
+  static uint32_t measureOpsPerSecond(uint16_t start);
+
+  // Cost and coverage of the n-th titled test of RAM_TEST_SUITE
+  static uint32_t getTestMillis(uint8_t testNumber, uint16_t length, uint32_t opsPerSecond);
+  static uint8_t getTestCoverage(uint8_t testNumber);
+
+  // Short name of a single PLAN_FAULT_* class
+  static const __FlashStringHelper *getFaultName(uint8_t fault);
+
+ private:
+  static void _plan(uint16_t length, bool npsf, uint32_t budgetMillis, uint32_t opsPerSecond,
+                    TestPlan &plan);
+};
+
+#endif  // TEST_PLANNER_H
@@ -0,0 +1,68 @@
+#ifndef TEST_RESULT_H
+#define TEST_RESULT_H
+
+#include <Arduino.h>
+
+// Error counts of a single memory test run
+struct TestResult {
+  uint32_t totalErrors;
+  uint32_t bitErrors[8];  // bitErrors[0] = failures of bit 0, etc.
+};
+
+// Vertical counter depth; flushed after ERROR_COUNTER_MAX mismatches
+#define ERROR_COUNTER_PLANES 4
+#define ERROR_COUNTER_MAX ((1 << ERROR_COUNTER_PLANES) - 1)
+
+/**
+ * ErrorCounter - Bit-sliced (vertical) per-bit error counters
+ *
+ * planes[n] holds bit n of all eight lane counters, so a whole diff byte is
+ * added with one ripple-carry of a few AND/XOR ops instead of a branch per
+ * bit. The planes are flushed into the wide TestResult counts before they can
+ * overflow, which keeps the cost per mismatching byte constant however many
+ * bits fail. Call flush() before the result is read.
+ */
+struct ErrorCounter {
+  uint8_t planes[ERROR_COUNTER_PLANES];
+  uint8_t adds;
+
+  inline void add(TestResult &result, uint8_t diff) {
+    if (diff == 0) {
+      return;
+    }
+    result.totalErrors++;
+
+    uint8_t carry = diff;
+    for (uint8_t n = 0; n < ERROR_COUNTER_PLANES; n++) {
+      uint8_t next = planes[n] & carry;
+      planes[n] ^= carry;
+      carry = next;
+    }
+    if (++adds == ERROR_COUNTER_MAX) {
+      flush(result);
+    }
+  }
+
+  void flush(TestResult &result) {
+    if (adds == 0) {
+      return;
+    }
+    // Shift one lane out of every plane at a time (no variable shifts on AVR)
+    for (uint8_t b = 0; b < 8; b++) {
+      uint8_t count = 0;
+      for (uint8_t n = ERROR_COUNTER_PLANES; n-- > 0;) {
+        count = (count << 1) | (planes[n] & 0x01);
+        planes[n] >>= 1;
+      }
+      result.bitErrors[b] += count;
+    }
+    adds = 0;
+  }
+};
+
+#define INIT_TEST_RESULT TestResult result = {}
+// Counts into the local ErrorCounter errors; FLUSH_ERRORS before using result
+#define UPDATE_ERRORS(diff) errors.add(result, diff)
+#define FLUSH_ERRORS errors.flush(result)
+
+#endif  // TEST_RESULT_H
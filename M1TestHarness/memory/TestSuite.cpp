@@ -0,0 +1,182 @@
+#include "./TestSuite.h"
+
+#include <Arduino.h>
+
+// March sequences (ported unchanged from the hand-written loops)
+const uint16_t MARCH_SUITE_C[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1),
+    MARCH_DOWN(MARCH_R1, MARCH_W0),
+    MARCH_DOWN(MARCH_R0),
+};
+const uint8_t MARCH_SUITE_C_COUNT = sizeof(MARCH_SUITE_C) / sizeof(MARCH_SUITE_C[0]);
+
+const uint16_t MARCH_SUITE_SS[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1),
+    MARCH_DOWN(MARCH_R1, MARCH_W0),
+    MARCH_DOWN(MARCH_R0, MARCH_W1),
+    MARCH_UP(MARCH_R1, MARCH_W0),
+    MARCH_UP(MARCH_R0),
+};
+const uint8_t MARCH_SUITE_SS_COUNT = sizeof(MARCH_SUITE_SS) / sizeof(MARCH_SUITE_SS[0]);
+
+const uint16_t MARCH_SUITE_LA[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1),
+    MARCH_DOWN(MARCH_R1, MARCH_W0),
+    MARCH_DOWN(MARCH_R0),
+};
+const uint8_t MARCH_SUITE_LA_COUNT = sizeof(MARCH_SUITE_LA) / sizeof(MARCH_SUITE_LA[0]);
+
+const uint16_t MOVING_INVERSION[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_W1),
+    MARCH_UP(MARCH_R1, MARCH_W0),
+    MARCH_UP(MARCH_R0),
+};
+const uint8_t MOVING_INVERSION_COUNT = sizeof(MOVING_INVERSION) / sizeof(MOVING_INVERSION[0]);
+
+// Fill five times per cell, then verify
+static const uint16_t SUITE_REPEATED_WRITE[] PROGMEM = {
+    MARCH_UP(MARCH_W0, MARCH_W0, MARCH_W0, MARCH_W0, MARCH_W0),
+    MARCH_UP(MARCH_R0),
+};
+
+// Fill once, then read every cell five times (repeated read and read destructive)
+static const uint16_t SUITE_REPEATED_READ[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0, MARCH_R0, MARCH_R0, MARCH_R0, MARCH_R0),
+};
+
+// Fill, then verify (checkerboard, walking bits, address uniqueness)
+static const uint16_t SUITE_WRITE_VERIFY[] PROGMEM = {
+    MARCH_UP(MARCH_W0),
+    MARCH_UP(MARCH_R0),
+};
+
+// Fill, hold for five delay periods, then verify
+static const uint16_t SUITE_RETENTION[] PROGMEM = {
+    MARCH_UP(MARCH_W0), MARCH_DELAY, MARCH_DELAY, MARCH_DELAY,
+    MARCH_DELAY,        MARCH_DELAY, MARCH_UP(MARCH_R0),
+};
+
+static const char TITLE_REPEATED_WRITE[] PROGMEM = "Repeated Write Test";
+static const char TITLE_REPEATED_READ[] PROGMEM = "Repeated Read Test";
+static const char TITLE_CHECKERBOARD[] PROGMEM = "Checkerboard Test (normal)";
+static const char TITLE_CHECKERBOARD_INVERTED[] PROGMEM = "Checkerboard Test (inverted)";
+static const char TITLE_WALKING_ONES[] PROGMEM = "Walking Ones Test";
+static const char TITLE_WALKING_ZEROS[] PROGMEM = "Walking Zeros Test";
+static const char TITLE_MARCH_C[] PROGMEM = "March C- Test";
+static const char TITLE_MOVING_INVERSION_00[] PROGMEM = "Moving Inversion Test (0x00)";
+static const char TITLE_MOVING_INVERSION_55[] PROGMEM = "Moving Inversion Test (0x55)";
+static const char TITLE_MOVING_INVERSION_RANDOM[] PROGMEM = "Moving Inversion Test (random)";
+static const char TITLE_MARCH_SS[] PROGMEM = "March SS Test";
+static const char TITLE_MARCH_LA[] PROGMEM = "March LA Test";
+static const char TITLE_READ_DESTRUCTIVE_AA[] PROGMEM = "Read Destructive Fault Test (0xAA)";
+static const char TITLE_READ_DESTRUCTIVE_55[] PROGMEM = "Read Destructive Fault Test (0x55)";
+static const char TITLE_ADDRESS_UNIQUENESS_55[] PROGMEM = "Address Uniqueness Test (0x55)";
+static const char TITLE_ADDRESS_UNIQUENESS_AA[] PROGMEM = "Address Uniqueness Test (0xAA)";
+static const char TITLE_RETENTION[] PROGMEM = "Retention Test (0xFF)";
+
+// Fault classes shared by several tests
+#define FAULTS_READ (PLAN_FAULT_STUCK | PLAN_FAULT_READ_DISTURB)
+#define FAULTS_DATA (PLAN_FAULT_STUCK | PLAN_FAULT_DATA)
+#define FAULTS_INVERSION (PLAN_FAULT_STUCK | PLAN_FAULT_TRANSITION | PLAN_FAULT_ADDRESS)
+#define FAULTS_MARCH (FAULTS_INVERSION | PLAN_FAULT_COUPLING)
+
+const SuiteTest RAM_TEST_SUITE[] PROGMEM = {
+    {TITLE_REPEATED_WRITE, MARCH_TABLE(SUITE_REPEATED_WRITE), 0x55, MARCH_DATA_SOLID, 0,
+     PLAN_FAULT_STUCK},
+    {TITLE_REPEATED_WRITE, MARCH_TABLE(SUITE_REPEATED_WRITE), 0x55, MARCH_DATA_SOLID, 0,
+     PLAN_FAULT_STUCK},
+    {TITLE_REPEATED_READ, MARCH_TABLE(SUITE_REPEATED_READ), 0x55, MARCH_DATA_SOLID,
+     SUITE_READ_ONCE, FAULTS_READ},
+    {TITLE_REPEATED_READ, MARCH_TABLE(SUITE_REPEATED_READ), 0x55, MARCH_DATA_SOLID,
+     SUITE_READ_ONCE, FAULTS_READ},
+    {TITLE_CHECKERBOARD, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x55, MARCH_DATA_CHECKERBOARD, 0,
+     FAULTS_DATA},
+    {TITLE_CHECKERBOARD_INVERTED, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xAA,
+     MARCH_DATA_CHECKERBOARD, 0, FAULTS_DATA},
+    {TITLE_WALKING_ONES, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x01, MARCH_DATA_SOLID, 0, FAULTS_DATA},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x02, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x04, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x08, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x10, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x20, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x40, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x80, MARCH_DATA_SOLID, 0, 0},
+    {TITLE_WALKING_ZEROS, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xFE, MARCH_DATA_SOLID, 0, FAULTS_DATA},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xFD, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xFB, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xF7, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xEF, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xDF, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xBF, MARCH_DATA_SOLID, 0, 0},
+    {nullptr, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x7F, MARCH_DATA_SOLID, 0, 0},
+    {TITLE_MARCH_C, MARCH_TABLE(MARCH_SUITE_C), 0x00, MARCH_DATA_SOLID, 0, FAULTS_MARCH},
+    {TITLE_MOVING_INVERSION_00, MARCH_TABLE(MOVING_INVERSION), 0x00, MARCH_DATA_SOLID, 0,
+     FAULTS_INVERSION},
+    {TITLE_MOVING_INVERSION_55, MARCH_TABLE(MOVING_INVERSION), 0x55, MARCH_DATA_SOLID, 0,
+     FAULTS_INVERSION | PLAN_FAULT_DATA},
+    {TITLE_MOVING_INVERSION_RANDOM, MARCH_TABLE(MOVING_INVERSION), 0x00, MARCH_DATA_RANDOM,
+     SUITE_RANDOM_PATTERN, PLAN_FAULT_STUCK | PLAN_FAULT_TRANSITION | PLAN_FAULT_DATA},
+    {TITLE_MARCH_SS, MARCH_TABLE(MARCH_SUITE_SS), 0x00, MARCH_DATA_SOLID, 0, FAULTS_MARCH},
+    {TITLE_MARCH_LA, MARCH_TABLE(MARCH_SUITE_LA), 0x00, MARCH_DATA_SOLID, 0, FAULTS_MARCH},
+    {TITLE_READ_DESTRUCTIVE_AA, MARCH_TABLE(SUITE_REPEATED_READ), 0xAA, MARCH_DATA_SOLID,
+     SUITE_READ_ONCE, FAULTS_READ},
+    {TITLE_READ_DESTRUCTIVE_55, MARCH_TABLE(SUITE_REPEATED_READ), 0x55, MARCH_DATA_SOLID,
+     SUITE_READ_ONCE, FAULTS_READ},
+    {TITLE_ADDRESS_UNIQUENESS_55, MARCH_TABLE(SUITE_WRITE_VERIFY), 0x55, MARCH_DATA_ADDRESS, 0,
+     PLAN_FAULT_STUCK},
+    {TITLE_ADDRESS_UNIQUENESS_AA, MARCH_TABLE(SUITE_WRITE_VERIFY), 0xAA, MARCH_DATA_ADDRESS, 0,
+     PLAN_FAULT_STUCK},
+    {TITLE_RETENTION, MARCH_TABLE(SUITE_RETENTION), 0xFF, MARCH_DATA_SOLID, 0,
+     PLAN_FAULT_RETENTION},
+};
+const uint8_t RAM_TEST_SUITE_COUNT = sizeof(RAM_TEST_SUITE) / sizeof(RAM_TEST_SUITE[0]);
+
+const __FlashStringHelper *getSuiteTitle(const SuiteTest *tests, uint8_t testCount,
+                                         uint8_t testNumber) {
+  for (uint8_t i = 0; i < testCount; i++) {
+    const char *title = (const char *)pgm_read_ptr(&tests[i].title);
+    if (title && testNumber-- == 0) {
+      return (const __FlashStringHelper *)title;
+    }
+  }
+  return nullptr;
+}
+
+uint8_t getSuiteFaults(const SuiteTest *tests, uint8_t testCount, uint8_t testNumber) {
+  for (uint8_t i = 0; i < testCount; i++) {
+    if (pgm_read_ptr(&tests[i].title) && testNumber-- == 0) {
+      return pgm_read_byte(&tests[i].faults);
+    }
+  }
+  return 0;
+}
+
+uint8_t getSuiteTitledCount(const SuiteTest *tests, uint8_t testCount) {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < testCount; i++) {
+    if (pgm_read_ptr(&tests[i].title)) {
+      count++;
+    }
+  }
+  return count;
+}
+
+uint32_t getSuiteFlagMask(const SuiteTest *tests, uint8_t testCount, uint8_t flags) {
+  uint32_t mask = 0;
+  uint8_t testNumber = 0;
+  for (uint8_t i = 0; i < testCount && testNumber < 32; i++) {
+    if (!pgm_read_ptr(&tests[i].title)) {
+      continue;
+    }
+    if (pgm_read_byte(&tests[i].flags) & flags) {
+      mask |= 1UL << testNumber;
+    }
+    testNumber++;
+  }
+  return mask;
+}
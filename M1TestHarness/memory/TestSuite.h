@@ -0,0 +1,74 @@
+#ifndef TEST_SUITE_H
+#define TEST_SUITE_H
+
+#include <Arduino.h>
+
+#include "./MarchTest.h"
+
+/**
+ * TestSuite - The RAM test suite expressed as March element programs
+ *
+ * Every test of the suite is a PROGMEM element table plus the background and
+ * cell data it runs with, so the whole suite is plain data that a scheduler can
+ * inspect, reorder or fuse (see SweepScheduler).
+ *
+ * A test that needs several backgrounds (e.g. walking ones) is split into one
+ * entry per background; all but the first entry have no title.
+ */
+
+// Test mask of all titled tests (see SweepScheduler::setTestMask)
+#define SUITE_ALL_TESTS 0xFFFFFFFFUL
+
+// Test flags
+#define SUITE_READ_ONCE 0x01       // A failing cell counts once across all reads of an element
+#define SUITE_RANDOM_PATTERN 0x02  // Seed (MARCH_DATA_RANDOM) is drawn when the test starts
+
+// Fault classes a test detects (SuiteTest::faults, TestPlanner coverage)
+#define PLAN_FAULT_STUCK 0x01         // Stuck-at cells and bits
+#define PLAN_FAULT_TRANSITION 0x02    // Cell fails to go up or down
+#define PLAN_FAULT_COUPLING 0x04      // Write of one cell disturbs another
+#define PLAN_FAULT_ADDRESS 0x08       // Address decoder (aliasing, no access)
+#define PLAN_FAULT_DATA 0x10          // Bits of a byte interact (data pattern)
+#define PLAN_FAULT_READ_DISTURB 0x20  // Read changes the cell
+#define PLAN_FAULT_RETENTION 0x40     // Cell loses its charge
+#define PLAN_FAULT_NPSF 0x80          // Neighbourhood pattern sensitive
+#define PLAN_FAULT_ALL 0xFF
+
+struct SuiteTest {
+  const char *title;         // PROGMEM string, nullptr continues the previous test
+  const uint16_t *elements;  // PROGMEM element table
+  uint8_t elementCount;
+  uint8_t pattern;  // Background
+  uint8_t data;     // MARCH_DATA_*
+  uint8_t flags;    // SUITE_*
+  uint8_t faults;   // PLAN_FAULT_* the test detects (0 on continuation entries)
+};
+
+// Element tables of the suite
+extern const uint16_t MARCH_SUITE_C[] PROGMEM;
+extern const uint8_t MARCH_SUITE_C_COUNT;
+extern const uint16_t MARCH_SUITE_SS[] PROGMEM;
+extern const uint8_t MARCH_SUITE_SS_COUNT;
+extern const uint16_t MARCH_SUITE_LA[] PROGMEM;
+extern const uint8_t MARCH_SUITE_LA_COUNT;
+extern const uint16_t MOVING_INVERSION[] PROGMEM;
+extern const uint8_t MOVING_INVERSION_COUNT;
+
+// Full RAM test suite in its reference order
+extern const SuiteTest RAM_TEST_SUITE[] PROGMEM;
+extern const uint8_t RAM_TEST_SUITE_COUNT;
+
+// Title of the n-th titled test of a suite (nullptr if there is none)
+const __FlashStringHelper *getSuiteTitle(const SuiteTest *tests, uint8_t testCount,
+                                         uint8_t testNumber);
+
+// Fault classes (PLAN_FAULT_*) of the n-th titled test of a suite (0 if there is none)
+uint8_t getSuiteFaults(const SuiteTest *tests, uint8_t testCount, uint8_t testNumber);
+
+// Number of titled tests of a suite
+uint8_t getSuiteTitledCount(const SuiteTest *tests, uint8_t testCount);
+
+// Test mask of the titled tests that have any of flags (SUITE_*)
+uint32_t getSuiteFlagMask(const SuiteTest *tests, uint8_t testCount, uint8_t flags);
+
+#endif  // TEST_SUITE_H
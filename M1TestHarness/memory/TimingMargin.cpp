@@ -0,0 +1,214 @@
+#include "./TimingMargin.h"
+
+#include <Arduino.h>
+#include <Model1LowLevel.h>
+
+#include "./MemoryBus.h"
+
+// A generated cycle: returns the data read, or value for a write
+typedef uint8_t (*DramCycle)(uint16_t address, uint8_t value);
+
+struct TimingCycles {
+  DramCycle read;
+  DramCycle write;
+};
+
+// Exact CPU cycles, resolved at compile time
+template <uint8_t CYCLES>
+static inline void delayCycles() {
+#ifdef __AVR__
+  __builtin_avr_delay_cycles(CYCLES);
+#endif
+}
+
+// One complete DRAM cycle, unrolled for its delays. The row address (A0-A6)
+// is latched by RAS, MUX presents the column (A7-A13) that CAS latches.
+template <bool WRITE, uint8_t RAS_TO_MUX, uint8_t MUX_TO_CAS, uint8_t CAS_WIDTH>
+static uint8_t dramCycle(uint16_t address, uint8_t value) {
+  uint8_t oldSREG = SREG;
+  cli();
+  Model1LowLevel::writeAddressBus(address);
+  if (WRITE) {
+    Model1LowLevel::writeDataBus(value);
+  }
+  Model1LowLevel::writeRAS(LOW);
+  delayCycles<RAS_TO_MUX>();
+  Model1LowLevel::writeMUX(LOW);
+  delayCycles<MUX_TO_CAS>();
+  if (WRITE) {
+    Model1LowLevel::writeWR(LOW);  // Early write: data is latched by CAS
+  } else {
+    Model1LowLevel::writeRD(LOW);
+  }
+  Model1LowLevel::writeCAS(LOW);
+  delayCycles<CAS_WIDTH>();
+  if (!WRITE) {
+    value = Model1LowLevel::readDataBus();
+  }
+  Model1LowLevel::writeCAS(HIGH);
+  if (WRITE) {
+    Model1LowLevel::writeWR(HIGH);
+  } else {
+    Model1LowLevel::writeRD(HIGH);
+  }
+  Model1LowLevel::writeMUX(HIGH);
+  Model1LowLevel::writeRAS(HIGH);
+  SREG = oldSREG;
+  return value;
+}
+
+#define TIMING_LONG 8
+#define TIMING_CYCLES(rasToMux, muxToCas, casWidth)        \
+  {&dramCycle<false, rasToMux, muxToCas, casWidth>,        \
+   &dramCycle<true, rasToMux, muxToCas, casWidth>}
+#define TIMING_SWEEP(P)                                                                      \
+  {P(TIMING_LONG), P(6), P(4), P(3), P(2), P(1), P(0)}
+#define TIMING_RAS_TO_MUX_STEP(n) TIMING_CYCLES(n, TIMING_LONG, TIMING_LONG)
+#define TIMING_MUX_TO_CAS_STEP(n) TIMING_CYCLES(TIMING_LONG, n, TIMING_LONG)
+#define TIMING_CAS_WIDTH_STEP(n) TIMING_CYCLES(TIMING_LONG, TIMING_LONG, n)
+
+static const uint8_t TIMING_STEP_CYCLES[TIMING_STEPS] PROGMEM = {TIMING_LONG, 6, 4, 3, 2, 1, 0};
+
+static const TimingCycles TIMING_CYCLE_TABLE[TIMING_PARAMETERS][TIMING_STEPS] PROGMEM = {
+    TIMING_SWEEP(TIMING_RAS_TO_MUX_STEP),
+    TIMING_SWEEP(TIMING_MUX_TO_CAS_STEP),
+    TIMING_SWEEP(TIMING_CAS_WIDTH_STEP),
+};
+
+static const char PARAMETER_RAS_TO_MUX[] PROGMEM = "RAS-MUX";
+static const char PARAMETER_MUX_TO_CAS[] PROGMEM = "MUX-CAS";
+static const char PARAMETER_CAS_WIDTH[] PROGMEM = "CAS";
+static const char *const PARAMETER_NAMES[TIMING_PARAMETERS] PROGMEM = {
+    PARAMETER_RAS_TO_MUX, PARAMETER_MUX_TO_CAS, PARAMETER_CAS_WIDTH};
+
+uint8_t TimingMargin::_minCycles[TIMING_PARAMETERS][2][8];
+
+uint16_t TimingMargin::_base = 0;
+uint8_t TimingMargin::_banks = 0;
+uint8_t TimingMargin::_parameter = TIMING_PARAMETERS;
+uint8_t TimingMargin::_step = 0;
+uint8_t TimingMargin::_readFailed = 0;
+uint8_t TimingMargin::_writeFailed = 0;
+
+// Take RAS, MUX and CAS over from the board, inactive (high)
+static void driveStrobes() {
+  Model1LowLevel::writeRAS(HIGH);
+  Model1LowLevel::writeMUX(HIGH);
+  Model1LowLevel::writeCAS(HIGH);
+  Model1LowLevel::configWriteRAS(OUTPUT);
+  Model1LowLevel::configWriteMUX(OUTPUT);
+  Model1LowLevel::configWriteCAS(OUTPUT);
+}
+
+// Back to the board's own strobes, as DiagnosticConsole leaves them
+static void releaseStrobes() {
+  Model1LowLevel::configWriteRAS(INPUT);
+  Model1LowLevel::writeRAS(LOW);
+  Model1LowLevel::configWriteMUX(INPUT);
+  Model1LowLevel::writeMUX(LOW);
+  Model1LowLevel::configWriteCAS(INPUT);
+  Model1LowLevel::writeCAS(LOW);
+}
+
+void TimingMargin::begin(uint16_t base, uint8_t banks) {
+  memset(_minCycles, TIMING_FAILED, sizeof(_minCycles));
+  _base = base;
+  _banks = banks;
+  _parameter = 0;
+  _step = 0;
+  _readFailed = 0;
+  _writeFailed = 0;
+}
+
+void TimingMargin::step(TestResult &result) {
+  if (isDone()) {
+    return;
+  }
+
+  uint8_t readBits = 0;
+  uint8_t writeBits = 0;
+  _probe(_base, _banks, _parameter, _step, 0x55, readBits, writeBits);
+  _probe(_base, _banks, _parameter, _step, 0xAA, readBits, writeBits);
+
+  // The longest delays are the reference: what fails there is a fault
+  if (_step == 0 && _parameter == 0) {
+    ErrorCounter errors = {};
+    UPDATE_ERRORS(readBits | writeBits);
+    FLUSH_ERRORS;
+  }
+
+  _readFailed |= readBits;
+  _writeFailed |= writeBits;
+  uint8_t cycles = pgm_read_byte(&TIMING_STEP_CYCLES[_step]);
+  for (uint8_t b = 0; b < 8; b++) {
+    if (!(_readFailed & (1 << b))) {
+      _minCycles[_parameter][0][b] = cycles;
+    }
+    if (!(_writeFailed & (1 << b))) {
+      _minCycles[_parameter][1][b] = cycles;
+    }
+  }
+
+  if (++_step >= TIMING_STEPS || (_readFailed == 0xFF && _writeFailed == 0xFF)) {
+    _parameter++;
+    _step = 0;
+    _readFailed = 0;
+    _writeFailed = 0;
+  }
+}
+
+bool TimingMargin::isDone() {
+  return _parameter >= TIMING_PARAMETERS;
+}
+
+uint8_t TimingMargin::getParameter() {
+  return _parameter;
+}
+
+void TimingMargin::_probe(uint16_t base, uint8_t banks, uint8_t parameter, uint8_t step,
+                          uint8_t pattern, uint8_t &readBits, uint8_t &writeBits) {
+  TimingCycles cycles;
+  memcpy_P(&cycles, &TIMING_CYCLE_TABLE[parameter][step], sizeof(cycles));
+
+  for (uint8_t bank = 0; bank < banks; bank++) {
+    // Read margin: known data over the bus, generated reads
+    for (uint8_t row = 0; row < DRAM_ROWS; row++) {
+      uint8_t value = (row & 1) ? ~pattern : pattern;
+      MemoryBus.fillPage(DramTopology::getAddress(base, bank, row, row), value, 1);
+    }
+    driveStrobes();
+    for (uint8_t row = 0; row < DRAM_ROWS; row++) {
+      uint8_t value = (row & 1) ? ~pattern : pattern;
+      readBits |= cycles.read(DramTopology::getAddress(base, bank, row, row), 0) ^ value;
+    }
+    releaseStrobes();
+
+    // Write margin: generated writes of the inverse, read back over the bus
+    driveStrobes();
+    Model1LowLevel::configWriteDataBus(0xFF);
+    for (uint8_t row = 0; row < DRAM_ROWS; row++) {
+      uint8_t value = (row & 1) ? pattern : ~pattern;
+      cycles.write(DramTopology::getAddress(base, bank, row, row), value);
+    }
+    Model1LowLevel::configWriteDataBus(0x00);  // As MemoryBus left it
+    releaseStrobes();
+    for (uint8_t row = 0; row < DRAM_ROWS; row++) {
+      uint8_t value = (row & 1) ? pattern : ~pattern;
+      uint8_t data;
+      MemoryBus.readPage(DramTopology::getAddress(base, bank, row, row), &data, 1);
+      writeBits |= data ^ value;
+    }
+  }
+}
+
+uint8_t TimingMargin::getMinCycles(uint8_t parameter, bool write, uint8_t bit) {
+  return _minCycles[parameter % TIMING_PARAMETERS][write ? 1 : 0][bit & 0x07];
+}
+
+uint8_t TimingMargin::getStepCycles(uint8_t step) {
+  return pgm_read_byte(&TIMING_STEP_CYCLES[step % TIMING_STEPS]);
+}
+
+const __FlashStringHelper *TimingMargin::getParameterName(uint8_t parameter) {
+  return (const __FlashStringHelper *)pgm_read_ptr(&PARAMETER_NAMES[parameter % TIMING_PARAMETERS]);
+}
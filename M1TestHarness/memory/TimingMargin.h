@@ -0,0 +1,81 @@
+#ifndef TIMING_MARGIN_H
+#define TIMING_MARGIN_H
+
+#include <Arduino.h>
+
+#include "./DramTopology.h"
+#include "./TestResult.h"
+
+// Timing parameters of a generated cycle
+#define TIMING_RAS_TO_MUX 0  // RAS falls until MUX switches to the column address
+#define TIMING_MUX_TO_CAS 1  // Column address until CAS falls
+#define TIMING_CAS_WIDTH 2   // CAS low until data is sampled (read) or CAS rises (write)
+#define TIMING_PARAMETERS 3
+
+// Added delays tried per parameter, longest first (see TIMING_STEP_CYCLES)
+#define TIMING_STEPS 7
+
+// Minimum of a bit that failed even with the longest delay
+#define TIMING_FAILED 0xFF
+
+// Added CPU cycles in nanoseconds at 16MHz
+#define TIMING_CYCLES_TO_NS(cycles) ((uint16_t)(cycles) * 125 / 2)
+
+/**
+ * TimingMargin - DRAM timing margins with directly generated RAS/MUX/CAS cycles
+ *
+ * The harness normally lets the board turn RD/WR into DRAM cycles. This test
+ * drives RAS, MUX and CAS itself (Model1LowLevel), with the added delays
+ * between the edges baked into unrolled code: every delay combination is its
+ * own template instance, so a cycle is a straight run of port writes and NOPs
+ * with interrupts disabled.
+ *
+ * Each parameter is swept from the longest to the shortest delay while the
+ * other two stay at the longest. At every step the diagonal of each bank
+ * (every row and every column once) is:
+ * - written over the normal bus and read with generated cycles (read margin)
+ * - written with generated cycles and read over the normal bus (write margin)
+ * with 0x55/0xAA alternating per cell and then inverted. Every data bit is
+ * one 4116, so the shortest delay at which a bit still passes is that chip's
+ * margin; a bit that fails in between is not tried shorter again.
+ *
+ * Delays are on top of the fixed cost of the port writes, so 0 means as fast
+ * as the harness can drive the strobes. Errors at the longest delays are
+ * real faults and go into the result.
+ *
+ * RAS, MUX and CAS are only driven around the generated cycles and released
+ * to the board before every MemoryBus access. The sweep is stepped
+ * (begin()/step()), one delay step of one parameter per call.
+ */
+class TimingMargin {
+ public:
+  // Sweep all parameters on banks starting at base (TEST signal and bus session active)
+  static void begin(uint16_t base, uint8_t banks);
+  static void step(TestResult &result);
+  static bool isDone();
+
+  // Parameter the next step() works on (TIMING_PARAMETERS when done)
+  static uint8_t getParameter();
+
+  // Shortest added delay in cycles a bit passed (TIMING_FAILED if never)
+  static uint8_t getMinCycles(uint8_t parameter, bool write, uint8_t bit);
+
+  // Added delay of a step, name of a parameter
+  static uint8_t getStepCycles(uint8_t step);
+  static const __FlashStringHelper *getParameterName(uint8_t parameter);
+
+ private:
+  static uint8_t _minCycles[TIMING_PARAMETERS][2][8];
+
+  static uint16_t _base;
+  static uint8_t _banks;
+  static uint8_t _parameter;
+  static uint8_t _step;
+  static uint8_t _readFailed;   // Bits failed at any step of the parameter so far
+  static uint8_t _writeFailed;
+
+  static void _probe(uint16_t base, uint8_t banks, uint8_t parameter, uint8_t step,
+                     uint8_t pattern, uint8_t &readBits, uint8_t &writeBits);
+};
+
+#endif  // TIMING_MARGIN_H
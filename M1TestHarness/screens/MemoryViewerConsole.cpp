@@ -0,0 +1,510 @@
+#include "./MemoryViewerConsole.h"
+
+#include <Adafruit_GFX.h>
+#include <Arduino.h>
+#include <M1Shield.h>
+#include <Model1.h>
+
+#include "../globals.h"
+#include "../memory/MemoryBus.h"
+#include "../memory/PatternSearch.h"
+
+static const char HEX_DIGITS[] PROGMEM = "0123456789ABCDEF";
+
+// Column layout: "XXXX: " + "XX " per byte + " " + one character per byte
+#define ADDRESS_DIGITS 4
+#define HEX_COLUMN 6
+#define ASCII_COLUMN(bytesPerLine) (HEX_COLUMN + (bytesPerLine)*3 + 1)
+
+// Changed bytes of a watch refresh: white on red
+#define HIGHLIGHT_COLOR 0xFFFF
+#define HIGHLIGHT_BACKGROUND 0xF800
+
+uint8_t MemoryViewerConsole::_pages[2][MEMORY_VIEWER_BUFFER_SIZE];
+uint8_t MemoryViewerConsole::_changed[MEMORY_VIEWER_BUFFER_SIZE / 8];
+static_assert(MEMORY_VIEWER_BUFFER_SIZE >= SEARCH_MIN_BUFFER, "Search must fit a page buffer");
+
+// Search line being received over the serial port
+static char input[MEMORY_VIEWER_INPUT_SIZE];
+static uint8_t inputLength = 0;
+
+MemoryViewerConsole::MemoryViewerConsole(uint16_t start, uint32_t end, bool watchable)
+    : ConsoleScreen() {
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  _start = start;
+  _end = end;
+  _currentAddress = start;
+  _pageMicros = 0;
+  _direction = 1;
+  _watchable = watchable;
+  _watching = false;
+
+  _lastRefresh = 0;
+  _statsStarted = 0;
+  _testMicros = 0;
+  _refreshes = 0;
+
+  _hitAddress = start;
+  _hitValid = false;
+
+  _shown = _pages[0];
+  _shownAddress = start;
+  _shownLength = 0;
+  _shownValid = false;
+
+  _prefetched = _pages[1];
+  _prefetchAddress = start;
+  _prefetchLength = 0;
+  _prefetchTime = 0;
+  _prefetchValid = false;
+  _prefetchPending = false;
+
+  // Set button labels for navigation
+  if (watchable) {
+    const __FlashStringHelper *buttons[] = {F("M:Exit"), F("U/D:Page"), F("LF:Find"),
+                                            F("RT:Watch")};
+    setButtonItemsF(buttons, 4);
+  } else {
+    const __FlashStringHelper *buttons[] = {F("M:Exit"), F("U/D:Page"), F("LF:Find")};
+    setButtonItemsF(buttons, 3);
+  }
+}
+
+void MemoryViewerConsole::_executeOnce() {
+  displayPage();
+}
+
+void MemoryViewerConsole::loop() {
+  ConsoleScreen::loop();
+  _pollSerial();
+
+  if (_watching) {
+    if (_shownValid && millis() - _lastRefresh >= MEMORY_VIEWER_WATCH_INTERVAL_MS) {
+      _lastRefresh = millis();
+      _refreshWatch();
+    }
+    return;
+  }
+
+  // Read ahead once the flip is on screen and no button is waiting
+  if (!_prefetchPending) {
+    return;
+  }
+  _prefetchPending = false;
+
+  uint16_t address;
+  if (!_getNextAddress(_direction, address)) {
+    return;
+  }
+  uint16_t length = _getLength(address);
+  if (_readPage(address, _prefetched, length)) {
+    _prefetchAddress = address;
+    _prefetchLength = length;
+    _prefetchTime = millis();
+    _prefetchValid = true;
+  }
+}
+
+void MemoryViewerConsole::displayPage() {
+  uint32_t started = micros();
+
+  // The read-ahead page is used while it is fresh, else the page is read now
+  bool hit = _prefetchValid && _prefetchAddress == _currentAddress &&
+             millis() - _prefetchTime < MEMORY_VIEWER_PREFETCH_MAX_AGE_MS;
+  uint16_t length = hit ? _prefetchLength : _getLength(_currentAddress);
+  if (!hit && !_readPage(_currentAddress, _prefetched, length)) {
+    length = 0;
+  }
+  _prefetchValid = false;
+
+  _drawPage(_prefetched, length);
+
+  // The page just drawn is what is on screen now
+  uint8_t *page = _prefetched;
+  _prefetched = _shown;
+  _shown = page;
+  _shownAddress = _currentAddress;
+  _shownLength = length;
+  _shownValid = true;
+  _prefetchPending = !_watching;
+  memset(_changed, 0, sizeof(_changed));
+
+  _pageMicros = micros() - started;
+  Globals.logger.infoF(F("Viewer page 0x%04X: %lu us (%s), %d bytes free"), _currentAddress,
+                       _pageMicros, hit ? "prefetched" : "read", _freeMemory());
+}
+
+void MemoryViewerConsole::_drawPage(const uint8_t *page, uint16_t length) {
+  uint8_t bytesPerLine = getBytesPerLine();
+  uint16_t linesPerPage = getLinesPerPage();
+  // Nothing to compare against: clear and draw every cell
+  bool full = !_shownValid;
+  if (full) {
+    cls();
+  }
+
+  for (uint16_t line = 0; line < linesPerPage; line++) {
+    uint16_t offset = line * bytesPerLine;
+    uint16_t address = _currentAddress + offset;
+    uint16_t shownAddress = _shownAddress + offset;
+
+    for (uint8_t digit = 0; digit < ADDRESS_DIGITS; digit++) {
+      uint8_t shift = (ADDRESS_DIGITS - 1 - digit) * 4;
+      uint8_t nibble = (address >> shift) & 0x0F;
+      if (full || nibble != ((shownAddress >> shift) & 0x0F)) {
+        _drawChar(digit, line, pgm_read_byte(&HEX_DIGITS[nibble]), 0xFFE0);  // Yellow
+      }
+    }
+    if (full) {
+      _drawChar(ADDRESS_DIGITS, line, ':', 0xFFE0);  // Yellow
+    }
+
+    for (uint8_t i = 0; i < bytesPerLine; i++, offset++) {
+      bool valid = offset < length;
+      bool wasValid = offset < _shownLength;
+      bool highlighted = _changed[offset >> 3] & (1 << (offset & 0x07));
+      if (!full && !highlighted && valid == wasValid &&
+          (!valid || page[offset] == _shown[offset])) {
+        continue;
+      }
+
+      _drawByte(line, i, page[offset], valid, false);
+    }
+  }
+
+  if (full && _watching) {
+    _drawWatchStatus();
+  }
+}
+
+void MemoryViewerConsole::_drawByte(uint16_t line, uint8_t index, uint8_t value, bool valid,
+                                    bool changed) {
+  uint8_t bytesPerLine = getBytesPerLine();
+  uint8_t hexColumn = HEX_COLUMN + index * 3;
+  uint16_t hexColor = changed ? HIGHLIGHT_COLOR : 0x07FF;      // Cyan
+  uint16_t asciiColor = changed ? HIGHLIGHT_COLOR : 0xFFFF;    // White
+  uint16_t background = changed ? HIGHLIGHT_BACKGROUND : 0x0000;
+
+  if (valid) {
+    _drawChar(hexColumn, line, pgm_read_byte(&HEX_DIGITS[value >> 4]), hexColor, background);
+    _drawChar(hexColumn + 1, line, pgm_read_byte(&HEX_DIGITS[value & 0x0F]), hexColor,
+              background);
+  } else {
+    _drawChar(hexColumn, line, '-', hexColor, background);
+    _drawChar(hexColumn + 1, line, '-', hexColor, background);
+  }
+
+  // Standard hex editor convention: 0x20-0x7F as is, everything else as "."
+  char c = !valid ? ' ' : (value >= 0x20 && value <= 0x7F) ? (char)value : '.';
+  _drawChar(ASCII_COLUMN(bytesPerLine) + index, line, c, asciiColor, background);
+}
+
+void MemoryViewerConsole::_drawChar(uint8_t column, uint8_t row, char c, uint16_t color,
+                                    uint16_t background) {
+  // Opaque background, so a changed cell needs no clearing
+  Adafruit_GFX &gfx = M1Shield.getGFX();
+  gfx.drawChar(_getContentLeft() + column * MEMORY_VIEWER_CHAR_WIDTH,
+               _getContentTop() + row * MEMORY_VIEWER_CHAR_HEIGHT, c,
+               M1Shield.convertColor(color), M1Shield.convertColor(background), 1);
+}
+
+void MemoryViewerConsole::_drawText(uint8_t column, uint8_t row, const char *text,
+                                    uint16_t color) {
+  while (*text) {
+    _drawChar(column++, row, *text++, color);
+  }
+}
+
+bool MemoryViewerConsole::_readPage(uint16_t address, uint8_t *buffer, uint16_t length) {
+  // The time the Z80 is held counts towards the TEST duty cycle of watch mode
+  uint32_t started = micros();
+  Model1.activateTestSignal();
+  bool ok = MemoryBus.beginSession();
+  if (ok) {
+    MemoryBus.readPage(address, buffer, length);
+    MemoryBus.endSession();
+  }
+  Model1.deactivateTestSignal();
+  _testMicros += micros() - started;
+  return ok;
+}
+
+void MemoryViewerConsole::setWatching(bool watching) {
+  if (!_watchable || watching == _watching) {
+    return;
+  }
+  _watching = watching;
+  _prefetchValid = false;
+  _prefetchPending = !watching;
+
+  _lastRefresh = millis();
+  _statsStarted = micros();
+  _testMicros = 0;
+  _refreshes = 0;
+  _drawWatchStatus();
+
+  if (!watching) {
+    // Drop the highlights of the last refresh
+    displayPage();
+  }
+}
+
+bool MemoryViewerConsole::isWatching() const {
+  return _watching;
+}
+
+void MemoryViewerConsole::_refreshWatch() {
+  uint8_t bytesPerLine = getBytesPerLine();
+  uint16_t linesPerPage = getLinesPerPage();
+
+  // The spare buffer is free while watching (no read-ahead)
+  uint8_t *line = _prefetched;
+  for (uint16_t row = 0; row < linesPerPage; row++) {
+    uint16_t offset = row * bytesPerLine;
+    if (offset >= _shownLength) {
+      break;
+    }
+    uint8_t length = (_shownLength - offset < bytesPerLine) ? _shownLength - offset : bytesPerLine;
+
+    // One short TEST window per line lets the Z80 run between the lines
+    if (!_readPage(_currentAddress + offset, line, length)) {
+      return;
+    }
+
+    // Unchanged bytes only lose the highlight of the last refresh
+    for (uint8_t i = 0; i < length; i++, offset++) {
+      uint8_t mask = 1 << (offset & 0x07);
+      bool wasChanged = _changed[offset >> 3] & mask;
+      bool changed = line[i] != _shown[offset];
+      if (changed) {
+        _shown[offset] = line[i];
+        _changed[offset >> 3] |= mask;
+      } else {
+        _changed[offset >> 3] &= ~mask;
+      }
+      if (changed || wasChanged) {
+        _drawByte(row, i, _shown[offset], true, changed);
+      }
+    }
+  }
+
+  _refreshes++;
+  if (micros() - _statsStarted >= MEMORY_VIEWER_WATCH_STATS_MS * 1000UL) {
+    _drawWatchStatus();
+    _statsStarted = micros();
+    _testMicros = 0;
+    _refreshes = 0;
+  }
+}
+
+void MemoryViewerConsole::_drawWatchStatus() {
+  // Below the page, in the two lines getLinesPerPage() keeps free
+  uint8_t row = getLinesPerPage() + 1;
+  char status[32];
+  if (!_watching) {
+    memset(status, ' ', sizeof(status) - 1);
+    status[sizeof(status) - 1] = '\0';
+  } else {
+    // Tenths of refreshes per second and of a percent of TEST time
+    uint32_t elapsed = micros() - _statsStarted;
+    uint16_t rate = elapsed ? (uint32_t)_refreshes * 10000000UL / elapsed : 0;
+    uint16_t duty = elapsed ? (uint64_t)_testMicros * 1000 / elapsed : 0;
+    snprintf_P(status, sizeof(status), PSTR("Watch %u.%u/s  TEST %u.%u%%    "), rate / 10,
+               rate % 10, duty / 10, duty % 10);
+  }
+  _drawText(0, row, status, 0xF81F);  // Magenta
+}
+
+bool MemoryViewerConsole::_getNextAddress(int8_t direction, uint16_t &address) const {
+  uint16_t pageSize = getPageSize();
+
+  // Only go back if there is a full page before the current one
+  if (direction < 0) {
+    if (_currentAddress < (uint32_t)_start + pageSize) {
+      return false;
+    }
+    address = _currentAddress - pageSize;
+    return true;
+  }
+
+  // Page on while the next page starts inside the range
+  if ((uint32_t)_currentAddress + pageSize >= _end) {
+    return false;
+  }
+  address = _currentAddress + pageSize;
+  return true;
+}
+
+uint16_t MemoryViewerConsole::_getLength(uint16_t address) const {
+  // Bytes of the page inside the range; the rest shows as "--"
+  uint32_t remaining = _end - address;
+  uint16_t pageSize = getPageSize();
+  return (remaining < pageSize) ? (uint16_t)remaining : pageSize;
+}
+
+Screen *MemoryViewerConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (_watchable && (action & BUTTON_RIGHT)) {
+    setWatching(!_watching);
+    return nullptr;
+  }
+  if (action & BUTTON_LEFT) {
+    if (PatternSearch.getLength() == 0) {
+      notifyF(F("Send a pattern over serial"));
+      Globals.logger.infoF(F("Search: send text (\"READY\") or hex bytes (C3 00 06)"));
+    } else {
+      _findNext();
+    }
+    return nullptr;
+  }
+
+  int8_t direction = 0;
+  if (action & UP_ANY) {
+    direction = -1;
+  } else if (action & DOWN_ANY) {
+    direction = 1;
+  }
+
+  uint16_t address;
+  if (direction != 0 && _getNextAddress(direction, address)) {
+    // The read-ahead follows the direction of the last flip
+    _direction = direction;
+    _currentAddress = address;
+    displayPage();
+  }
+
+  return nullptr;
+}
+
+void MemoryViewerConsole::_pollSerial() {
+  // Collect a line without blocking the screen
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c != '\n' && c != '\r') {
+      if (inputLength < MEMORY_VIEWER_INPUT_SIZE - 1) {
+        input[inputLength++] = c;
+      }
+      continue;
+    }
+    if (inputLength == 0) {
+      continue;
+    }
+    input[inputLength] = '\0';
+    inputLength = 0;
+
+    if (!PatternSearch.begin(input)) {
+      Globals.logger.errF(F("Search: pattern must be 1 to %d bytes"), SEARCH_MAX_PATTERN);
+      continue;
+    }
+    Globals.logger.infoF(F("Search: %d byte pattern"), PatternSearch.getLength());
+    _hitValid = false;
+    _findNext();
+  }
+}
+
+void MemoryViewerConsole::_findNext() {
+  // After the last match, else from the page on screen; wraps once to the start
+  uint32_t from = _hitValid ? (uint32_t)_hitAddress + 1 : _currentAddress;
+  uint32_t started = micros();
+  uint16_t address;
+  bool found = false;
+
+  // After the wrap only matches starting before from are new; they may end
+  // up to length - 1 bytes past it
+  uint32_t wrapEnd = from + PatternSearch.getLength() - 1;
+  if (wrapEnd > _end) {
+    wrapEnd = _end;
+  }
+
+  // The read-ahead page lends its buffer to the search
+  _prefetchValid = false;
+  Model1.activateTestSignal();
+  if (MemoryBus.beginSession()) {
+    found = (from < _end && PatternSearch.find(from, _end, address, _prefetched,
+                                               MEMORY_VIEWER_BUFFER_SIZE)) ||
+            (from > _start && PatternSearch.find(_start, wrapEnd, address, _prefetched,
+                                                 MEMORY_VIEWER_BUFFER_SIZE));
+    MemoryBus.endSession();
+  }
+  Model1.deactivateTestSignal();
+  uint32_t elapsed = micros() - started;
+
+  if (!found) {
+    notifyF(F("Pattern not found"));
+    Globals.logger.infoF(F("Search: not found (%lu us)"), elapsed);
+    return;
+  }
+  Globals.logger.infoF(F("Search: found at 0x%04X (%lu us)"), address, elapsed);
+  _hitAddress = address;
+  _hitValid = true;
+  _showHit();
+}
+
+void MemoryViewerConsole::_showHit() {
+  // Page of the match as paging would reach it
+  uint16_t pageSize = getPageSize();
+  uint16_t page = _start + ((_hitAddress - _start) / pageSize) * pageSize;
+  if (page != _currentAddress || !_shownValid) {
+    _direction = (page < _currentAddress) ? -1 : 1;
+    _currentAddress = page;
+    displayPage();
+  }
+
+  // Highlight the match up to the end of the page
+  uint8_t bytesPerLine = getBytesPerLine();
+  uint16_t offset = _hitAddress - _currentAddress;
+  for (uint8_t k = 0; k < PatternSearch.getLength() && offset < _shownLength; k++, offset++) {
+    _changed[offset >> 3] |= 1 << (offset & 0x07);
+    _drawByte(offset / bytesPerLine, offset % bytesPerLine, _shown[offset], true, true);
+  }
+}
+
+uint32_t MemoryViewerConsole::getPageMicros() const {
+  return _pageMicros;
+}
+
+uint16_t MemoryViewerConsole::getLinesPerPage() const {
+  // Account for header (2 lines: title + blank line), 8 pixels per line at text size 1
+  uint16_t availableHeight = _getContentHeight();
+  uint16_t headerHeight = 2 * MEMORY_VIEWER_CHAR_HEIGHT;
+  uint16_t calculatedLines = (availableHeight - headerHeight) / MEMORY_VIEWER_CHAR_HEIGHT;
+
+  // At least 5 lines, and no more than a page buffer holds
+  if (calculatedLines < 5) {
+    calculatedLines = 5;
+  }
+  uint16_t maxLines = MEMORY_VIEWER_BUFFER_SIZE / getBytesPerLine();
+  if (calculatedLines > maxLines) {
+    calculatedLines = maxLines;
+  }
+  return calculatedLines;
+}
+
+uint16_t MemoryViewerConsole::getBytesPerLine() const {
+  // Format: "XXXX: " (6 chars) + hex bytes (3 chars each) + " " (1 char) + ASCII (1 char each)
+  // Total per byte: 4 characters, fixed overhead: 7 characters
+  uint16_t maxChars = _getContentWidth() / MEMORY_VIEWER_CHAR_WIDTH;
+  uint16_t calculatedBytes = (maxChars > 7) ? (maxChars - 7) / 4 : MEMORY_VIEWER_MIN_BYTES_PER_LINE;
+
+  if (calculatedBytes < MEMORY_VIEWER_MIN_BYTES_PER_LINE) {
+    calculatedBytes = MEMORY_VIEWER_MIN_BYTES_PER_LINE;
+  } else if (calculatedBytes > MEMORY_VIEWER_MAX_BYTES_PER_LINE) {
+    calculatedBytes = MEMORY_VIEWER_MAX_BYTES_PER_LINE;
+  }
+
+  // Prefer multiples of 8 for better alignment
+  return (calculatedBytes / 8) * 8;
+}
+
+uint16_t MemoryViewerConsole::getPageSize() const {
+  return getBytesPerLine() * getLinesPerPage();
+}
+
+int MemoryViewerConsole::_freeMemory() {
+  char top;
+  extern char __heap_start;  // Linker symbol: its address is the heap start
+  extern char *__brkval;
+
+  return &top - (__brkval ? __brkval : &__heap_start);
+}
@@ -0,0 +1,128 @@
+#ifndef MEMORY_VIEWER_CONSOLE_H
+#define MEMORY_VIEWER_CONSOLE_H
+
+#include <ConsoleScreen.h>
+
+// Largest page a buffer holds (lines per page are capped to fit)
+#define MEMORY_VIEWER_BUFFER_SIZE 384
+#define MEMORY_VIEWER_MIN_BYTES_PER_LINE 8
+#define MEMORY_VIEWER_MAX_BYTES_PER_LINE 32
+
+// Character cell at text size 1
+#define MEMORY_VIEWER_CHAR_WIDTH 6
+#define MEMORY_VIEWER_CHAR_HEIGHT 8
+
+// A prefetched page older than this is read again (the Z80 may have changed it)
+#define MEMORY_VIEWER_PREFETCH_MAX_AGE_MS 1000
+
+// Watch mode: refresh period and how often its rates are shown
+#define MEMORY_VIEWER_WATCH_INTERVAL_MS 250
+#define MEMORY_VIEWER_WATCH_STATS_MS 1000
+
+// Longest search line accepted from the serial port
+#define MEMORY_VIEWER_INPUT_SIZE 72
+
+/**
+ * MemoryViewerConsole - Hex dump of an address range, one page per screen
+ *
+ * Shared by the ROM, VRAM and DRAM viewers. A page is burst-read once over a
+ * MemoryBus session into one of two static buffers; nothing is allocated.
+ *
+ * The first page is drawn in full. After that a page flip compares the new
+ * bytes with the ones on screen and only repaints the address digits, hex
+ * pairs and characters that differ, straight to the display (as M1Terminal
+ * does). While the viewer is idle, loop() reads ahead the page in the last
+ * paging direction into the other buffer, so the next flip is paint only.
+ * Each flip logs its time and the free memory.
+ *
+ * Viewers of memory the Z80 writes (DRAM, VRAM) can watch the page while the
+ * machine runs: every MEMORY_VIEWER_WATCH_INTERVAL_MS each line is read in
+ * its own short TEST window and compared byte by byte with the one on
+ * screen. Only the bytes that differ are redrawn, highlighted until the next
+ * refresh.
+ * The status line shows the refreshes per second achieved and the share of
+ * time the TEST signal held the Z80.
+ *
+ * A line sent over the serial port sets a search pattern (see PatternSearch)
+ * and jumps to its first match in the range; LEFT jumps to the next one,
+ * wrapping at the end. The bytes of a match are highlighted.
+ *
+ * Subclasses only set the range and title and return their menu.
+ */
+class MemoryViewerConsole : public ConsoleScreen {
+ public:
+  // Range is start up to (not including) end; watchable enables watch mode
+  MemoryViewerConsole(uint16_t start, uint32_t end, bool watchable = false);
+
+  void loop() override;
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+  // Read and render time of the last page
+  uint32_t getPageMicros() const;
+
+  // Watch mode
+  void setWatching(bool watching);
+  bool isWatching() const;
+
+ protected:
+  uint16_t _currentAddress;
+
+  void _executeOnce() override;
+  void displayPage();
+
+  uint16_t getLinesPerPage() const;
+  uint16_t getBytesPerLine() const;
+  uint16_t getPageSize() const;
+
+ private:
+  uint16_t _start;
+  uint32_t _end;
+  uint32_t _pageMicros;
+  int8_t _direction;  // Last paging direction, the prefetch follows it
+  bool _watchable;
+  bool _watching;
+
+  uint32_t _lastRefresh;    // millis() of the last watch refresh
+  uint32_t _statsStarted;   // micros() the rates are counted from
+  uint32_t _testMicros;     // TEST signal held since _statsStarted
+  uint16_t _refreshes;      // Refreshes since _statsStarted
+
+  uint16_t _hitAddress;     // Last search match
+  bool _hitValid;
+
+  uint8_t *_shown;          // Bytes on screen
+  uint16_t _shownAddress;
+  uint16_t _shownLength;    // Bytes of the page inside the range
+  bool _shownValid;         // Something is drawn (else the next page is drawn in full)
+
+  uint8_t *_prefetched;     // Read-ahead page, also where a page is read on a miss
+  uint16_t _prefetchAddress;
+  uint16_t _prefetchLength;
+  uint32_t _prefetchTime;   // millis() of the read
+  bool _prefetchValid;
+  bool _prefetchPending;    // One read-ahead after each flip, even if it fails
+
+  // Only one screen exists at a time, so all viewers share the pages
+  static uint8_t _pages[2][MEMORY_VIEWER_BUFFER_SIZE];
+  static uint8_t _changed[MEMORY_VIEWER_BUFFER_SIZE / 8];  // Bytes drawn highlighted
+
+  bool _getNextAddress(int8_t direction, uint16_t &address) const;
+  uint16_t _getLength(uint16_t address) const;
+  bool _readPage(uint16_t address, uint8_t *buffer, uint16_t length);
+  void _drawPage(const uint8_t *page, uint16_t length);
+  void _drawByte(uint16_t line, uint8_t index, uint8_t value, bool valid, bool changed);
+  void _drawChar(uint8_t column, uint8_t row, char c, uint16_t color,
+                 uint16_t background = 0x0000);
+  void _drawText(uint8_t column, uint8_t row, const char *text, uint16_t color);
+
+  void _pollSerial();
+  void _findNext();
+  void _showHit();
+
+  void _refreshWatch();
+  void _drawWatchStatus();
+
+  static int _freeMemory();
+};
+
+#endif  // MEMORY_VIEWER_CONSOLE_H
@@ -5,21 +5,38 @@
 #include <Model1.h>
 
 #include "../globals.h"
+#include "../memory/DramTopology.h"
+#include "../memory/FaultLog.h"
+#include "../memory/MemoryBus.h"
+#include "../memory/QuickScreen.h"
 
-#define INIT_TEST_RESULT TestResult result = {}
-#define UPDATE_ERRORS(diff)           \
-  if (diff != 0) {                    \
-    result.totalErrors++;             \
-    for (uint8_t b = 0; b < 8; b++) { \
-      if (diff & (1 << b))            \
-        result.bitErrors[b]++;        \
-    }                                 \
+// Title of the test a FaultLog source names (nullptr if unknown)
+static const __FlashStringHelper *getSourceTitle(uint8_t test) {
+  if (test < FAULT_TEST_SUITE_END) {
+    return getSuiteTitle(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, test);
   }
+  if (test >= FAULT_TEST_TOPOLOGY && test < FAULT_TEST_TOPOLOGY + DRAM_TOPOLOGY_TEST_COUNT) {
+    return DramTopology::getTitle(test - FAULT_TEST_TOPOLOGY);
+  }
+  if (test == FAULT_TEST_ROW_HAMMER) {
+    return F("Row Hammer Test");
+  }
+  if (test == FAULT_TEST_GALPAT) {
+    return F("GALPAT Test");
+  }
+  return nullptr;
+}
 
 RAMTestSuiteConsole::RAMTestSuiteConsole() : ConsoleScreen() {
+  _run = {};
+  _run.state = SUITE_RUN_IDLE;
+  _companion = {};
 }
 
 void RAMTestSuiteConsole::close() {
+  // Leaving the screen (MENU) cancels a running suite
+  cancelRun();
+
   // Turn off LED indicator when leaving the screen
   M1Shield.setLEDColor(COLOR_OFF);
 
@@ -32,625 +49,763 @@ void RAMTestSuiteConsole::runSpecializedTest(uint16_t start, uint16_t length,
   runAndEvaluate(start, length, icRefs);
 }
 
-TestResult RAMTestSuiteConsole::runRepeatedWriteTest(uint16_t start, uint16_t length,
-                                                     bool toggleStart) {
-  uint8_t data;
-  INIT_TEST_RESULT;
+void RAMTestSuiteConsole::runScreenedTest(uint16_t start, uint16_t length,
+                                          const char *const icRefs[]) {
+  runAndEvaluate(start, length, icRefs);
+  _run.screening = true;
+}
 
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Repeated Write Test"));
-  setTextColor(0xFFFF, 0x0000);  // White
+void RAMTestSuiteConsole::setExtendedTests(uint8_t extended) {
+  _run.extended = extended;
+}
 
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    for (uint16_t j = 0; j < 5; j++) {
-      Model1.writeMemory(start + i, 0x55);
-    }
-  }
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x55;
-    UPDATE_ERRORS(diff);
-  }
-  println();
+void RAMTestSuiteConsole::runSteppedTest(uint16_t start, const char *const icRefs[]) {
+  runAndEvaluate(start, 0, icRefs);
+  _run.stepped = true;
+}
 
-  return result;
+bool RAMTestSuiteConsole::beginTest() {
+  return false;
 }
 
-TestResult RAMTestSuiteConsole::runRepeatedReadTest(uint16_t start, uint16_t length,
-                                                    bool toggleStart) {
-  uint8_t data;
-  INIT_TEST_RESULT;
+bool RAMTestSuiteConsole::stepTest() {
+  return false;
+}
 
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Repeated Read Test"));
-  setTextColor(0xFFFF, 0x0000);  // White
+void RAMTestSuiteConsole::cancelTest() {}
 
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, 0x55);
-  }
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    for (uint16_t j = 0; j < 5; j++) {
-      data = Model1.readMemory(start + i);
-    }
-    uint8_t diff = data ^ 0x55;
-    UPDATE_ERRORS(diff);
-  }
-  println();
+void RAMTestSuiteConsole::runSoakTest(uint16_t start, uint16_t length,
+                                      const char *const icRefs[], uint32_t testMask,
+                                      uint16_t maxPasses, uint32_t maxMillis) {
+  runAndEvaluate(start, length, icRefs);
+  _run.startDelayMs = 0;
+  _run.testMask = testMask;
+  _run.soakPasses = maxPasses;
+  _run.soakMillis = maxMillis;
+  _run.soaking = true;
+}
 
-  return result;
+void RAMTestSuiteConsole::runSelectedTests(uint16_t start, uint16_t length,
+                                           const char *const icRefs[], uint32_t testMask,
+                                           uint8_t extended) {
+  runAndEvaluate(start, length, icRefs);
+  _run.startDelayMs = 0;
+  _run.testMask = testMask;
+  _run.extended = extended;
 }
 
-TestResult RAMTestSuiteConsole::runCheckerboardTest(uint16_t start, uint16_t length,
-                                                    bool toggleStart) {
-  uint8_t data;
-  INIT_TEST_RESULT;
+void RAMTestSuiteConsole::runComposedTest(uint16_t start, uint16_t length,
+                                          const char *const icRefs[],
+                                          const SuiteComposition &composition) {
+  runSelectedTests(start, length, icRefs, composition.getPassMask(0),
+                   composition.npsf ? SUITE_EXTENDED_NPSF : 0);
+  _run.composition = &composition;
+}
 
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Checkerboard Test"));
-  setTextColor(0xFFFF, 0x0000);  // White
-  if (toggleStart) {
-    print(F("(normal)"));
-  } else {
-    print(F("(inverted)"));
-  }
+void RAMTestSuiteConsole::setReplaySeed(uint16_t seed, uint16_t stride) {
+  _scheduler.setSeed(seed, stride);
+}
 
-  print(F("."));
-  bool toggle = toggleStart;
-  for (uint16_t i = 0; i < length; i++) {
-    if (toggle) {
-      Model1.writeMemory(start + i, 0x55);
-    } else {
-      Model1.writeMemory(start + i, 0xAA);
-    }
-    toggle = !toggle;
+void RAMTestSuiteConsole::stopSoak() {
+  if (isSoakRunning()) {
+    // The pass in progress is dropped, the report covers the passes done
+    println();
+    finishSoak();
   }
-  print(F("."));
-  toggle = toggleStart;
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    if (toggle) {
-      uint8_t diff = data ^ 0x55;
-      UPDATE_ERRORS(diff);
-    } else {
-      uint8_t diff = data ^ 0xAA;
-      UPDATE_ERRORS(diff);
-    }
-    toggle = !toggle;
-  }
-  println();
-
-  return result;
 }
 
-TestResult RAMTestSuiteConsole::runWalkingOnesTest(uint16_t start, uint16_t length) {
-  uint8_t data;
-  INIT_TEST_RESULT;
+bool RAMTestSuiteConsole::isSoakRunning() const {
+  return _run.soaking && (_run.state == SUITE_RUN_RUNNING || _run.state == SUITE_RUN_PAUSED);
+}
 
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Walking Ones Test"));
-  setTextColor(0xFFFF, 0x0000);  // White
+void RAMTestSuiteConsole::runCombinedTest(uint16_t start, uint16_t length,
+                                          const char *const icRefs[], uint16_t companionStart,
+                                          uint16_t companionLength,
+                                          const char *const companionIcRefs[]) {
+  runAndEvaluate(start, length, icRefs);
+  _run.startDelayMs = 0;
+  _companion.start = companionStart;
+  _companion.length = companionLength;
+  _companion.icRefs = companionIcRefs;
+}
 
-  for (uint8_t bit = 0; bit < 8; bit++) {
-    uint8_t pattern = 1 << bit;
-    print(F("."));
+// DRAM is made of 4116 (128 x 128) chips, video RAM of 2102 (32 x 32)
+static uint8_t getMatrixBits(uint16_t start) {
+  return (start >= 0x4000) ? FAULT_LOG_4116_BITS : FAULT_LOG_2102_BITS;
+}
 
-    // Write
-    for (uint16_t i = 0; i < length; i++) {
-      Model1.writeMemory(start + i, pattern);
-    }
+bool RAMTestSuiteConsole::beginTestRun(uint16_t start) {
+  Model1.activateTestSignal();
+  M1Shield.setLEDColor(COLOR_BLUE);  // Initialize test suite
+  setTextColor(0xFFFF, 0x0000);      // White
 
-    // Read
-    for (uint16_t i = 0; i < length; i++) {
-      data = Model1.readMemory(start + i);
-      uint8_t diff = data ^ pattern;
-      UPDATE_ERRORS(diff);
-    }
+  // All tests share one burst session with the bus configured once
+  if (!MemoryBus.beginSession()) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Unable to access memory bus"));
+    Model1.deactivateTestSignal();
+    M1Shield.setLEDColor(COLOR_RED);
+    return false;
   }
-  println();
+  MemoryBus.resetStats();
 
-  return result;
+  uint8_t matrixBits = getMatrixBits(start);
+  FaultLog.begin(start, matrixBits, matrixBits);
+  return true;
 }
 
-TestResult RAMTestSuiteConsole::runWalkingZerosTest(uint16_t start, uint16_t length) {
-  uint8_t data;
-  INIT_TEST_RESULT;
-
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Walking Zeros Test"));
-  setTextColor(0xFFFF, 0x0000);  // White
+void RAMTestSuiteConsole::printSummary(const TestResult &result, const char *const icRefs[],
+                                       const AddressLineResult *lines) {
+  setProgressValue(100);
 
-  for (uint8_t bit = 0; bit < 8; bit++) {
-    uint8_t pattern = ~(1 << bit);
-    print(F("."));
+  MemoryBus.endSession();
 
-    // Write
-    for (uint16_t i = 0; i < length; i++) {
-      Model1.writeMemory(start + i, pattern);
-    }
+  cls();
+  println(F("--- Summary ---"));
 
-    // Read
-    for (uint16_t i = 0; i < length; i++) {
-      data = Model1.readMemory(start + i);
-      uint8_t diff = data ^ pattern;
-      UPDATE_ERRORS(diff);
+  // Print per-bit totals using PROGMEM strings
+  for (uint8_t b = 0; b < 8; b++) {
+    setTextColor(0xFFFF, 0x0000);  // White
+    print(F("Bit "));
+    print(b);
+    print(F(" ("));
+    print(icRefs[b]);
+    print(F("): "));
+    if (result.bitErrors[b] == 0) {
+      setTextColor(0x07E0, 0x0000);  // Green
+    } else {
+      setTextColor(0xF800, 0x0000);  // Red
     }
+    println(result.bitErrors[b]);
+  }
+  if (lines) {
+    printAddressLines(*lines);
   }
-  println();
-
-  return result;
-}
-
-TestResult RAMTestSuiteConsole::runMarchCTest(uint16_t start, uint16_t length) {
-  uint8_t data;
-  INIT_TEST_RESULT;
-
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("March C- Test"));
   setTextColor(0xFFFF, 0x0000);  // White
 
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, 0x00);
+  print(F("Total Errors: "));
+  if (result.totalErrors == 0) {
+    setTextColor(0x07E0, 0x0000);  // Green
+  } else {
+    setTextColor(0xF800, 0x0000);  // Red
   }
+  println(result.totalErrors);
+  setTextColor(0xFFFF, 0x0000);  // White
 
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0xFF);
-  }
+  // Burst throughput achieved on this board (bus time only, excludes delays)
+  print(F("Throughput: "));
+  print(MemoryBus.getBytesPerSecond());
+  print(F(" bytes/s ("));
+  print(MemoryBus.getBusOperations());
+  println(F(" ops)"));
+}
 
-  print(F("."));
-  for (int16_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0xFF;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0x00);
+void RAMTestSuiteConsole::endTestRun(const TestResult &result, const char *const icRefs[]) {
+  if (result.totalErrors > 0) {
+    printFaultPatterns(icRefs);
   }
 
-  print(F("."));
-  for (int16_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-  }
-  println();
+  Model1.deactivateTestSignal();
 
-  return result;
+  // Final LED status indication based on test results
+  if (result.totalErrors == 0) {
+    // All tests passed
+    M1Shield.setLEDColor(COLOR_GREEN);
+  } else {
+    // Errors found
+    M1Shield.setLEDColor(COLOR_RED);
+  }
 }
 
-TestResult RAMTestSuiteConsole::runMovingInversionTest(uint16_t start, uint16_t length,
-                                                       uint8_t pattern) {
-  uint8_t data;
-  INIT_TEST_RESULT;
+void RAMTestSuiteConsole::runAndEvaluate(uint16_t start, uint16_t length,
+                                         const char *const icRefs[]) {
+  _run.start = start;
+  _run.length = length;
+  _run.icRefs = icRefs;
+  _run.waitStarted = millis();
+  _run.startDelayMs = SUITE_RUN_START_DELAY_MS;
+  _run.testMask = SUITE_ALL_TESTS;
+  _run.screening = false;
+  _run.soaking = false;
+  _run.stepped = false;
+  _run.seed = 0;
+  _run.extendedActive = false;
+  _run.composition = nullptr;
+  _run.pass = 0;
+  _companion.icRefs = nullptr;
+  _run.state = SUITE_RUN_WAITING;
+}
 
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Moving Inversion Test (0x"));
-  print(pattern, HEX);
-  print(F(")"));
-  setTextColor(0xFFFF, 0x0000);  // White
+void RAMTestSuiteConsole::loop() {
+  ConsoleScreen::loop();
 
-  // First pattern: 0x00
-  uint8_t antipattern = ~pattern;
+  switch (_run.state) {
+    case SUITE_RUN_WAITING:
+      if (millis() - _run.waitStarted < _run.startDelayMs) {
+        break;
+      }
+      cls();
+      if (!beginTestRun(_run.start)) {
+        _run.state = SUITE_RUN_IDLE;
+        break;
+      }
+      _run.runStarted = millis();
+      if (_run.stepped) {
+        if (!beginTest()) {
+          MemoryBus.endSession();
+          Model1.deactivateTestSignal();
+          _run.state = SUITE_RUN_DONE;
+          break;
+        }
+        _run.state = SUITE_RUN_RUNNING;
+        break;
+      }
+      if (_run.screening && !screenRun()) {
+        break;
+      }
 
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, pattern);
-  }
+      // Address lines first; every faulty line counts as an error of the run
+      setTextColor(0x07FF, 0x0000);  // Cyan
+      println(F("Address Line Test"));
+      setTextColor(0xFFFF, 0x0000);  // White
+      runAddressLines(_run.start, _run.length, _run.lines, _run.result);
+      if (_companion.icRefs) {
+        runAddressLines(_companion.start, _companion.length, _companion.lines,
+                        _companion.result);
+        _companionScheduler.begin(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, _companion.start,
+                                  _companion.length);
+      }
 
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ pattern;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, antipattern);
-  }
+      // Run the whole suite as one fused schedule; errors accumulate directly
+      _run.test = 0xFF;
+      _run.titledTests = 0;
+      _run.led = COLOR_BLUE;
+      if (_run.soaking) {
+        _soak.begin();
+        _run.led = COLOR_CYAN;
+        M1Shield.setLEDColor(COLOR_CYAN);
+      }
+      _scheduler.setTestMask(_run.testMask);
+      _scheduler.begin(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, _run.start, _run.length);
+      _run.state = SUITE_RUN_RUNNING;
+      break;
 
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ antipattern;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, pattern);
+    case SUITE_RUN_RUNNING:
+      stepRun();
+      break;
   }
+}
 
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ pattern;
-    UPDATE_ERRORS(diff);
+void RAMTestSuiteConsole::runAddressLines(uint16_t start, uint16_t length,
+                                          AddressLineResult &lines, TestResult &result) {
+  result = {};
+  AddressLineTest::run(start, length, lines);
+  for (uint16_t bits = lines.stuck | lines.shorted; bits; bits &= bits - 1) {
+    result.totalErrors++;
   }
-  println();
-
-  return result;
 }
 
-TestResult RAMTestSuiteConsole::runRetentionTest(uint16_t start, uint16_t length, uint8_t pattern,
-                                                 uint32_t delayMs, uint8_t repeatDelay) {
-  uint8_t data;
-  INIT_TEST_RESULT;
-
+bool RAMTestSuiteConsole::screenRun() {
+  setProgressValue(2);
+  M1Shield.setLEDColor(COLOR_BLUE);
   setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Retention Test (0x"));
-  print(pattern, HEX);
-  print(F(")"));
-  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("Quick screen"));
 
-  // Fill with pattern
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, pattern);
-  }
+  uint8_t matrixBits = getMatrixBits(_run.start);
+  ScreenResult screen;
+  QuickScreen::run(_run.start, _run.length, matrixBits, screen);
 
-  for (uint16_t i = 0; i < repeatDelay; i++) {
-    print(F("."));
-    delay(delayMs);
+  if (QuickScreen::passed(screen)) {
+    _run.state = SUITE_RUN_DONE;
+    printSummary(screen.result, _run.icRefs);
+    setTextColor(0x07E0, 0x0000);  // Green
+    println(F("Quick screen passed"));
+    printVerdictTime();
+    endTestRun(screen.result, _run.icRefs);
+    return false;
   }
-  // Verify
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ pattern;
-    UPDATE_ERRORS(diff);
+
+  setTextColor(0xF800, 0x0000);  // Red
+  println(F(" FAIL"));
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("Bits:"));
+  for (uint8_t b = 0; b < 8; b++) {
+    if (screen.result.bitErrors[b] > 0) {
+      print(F(" "));
+      print(_run.icRefs[b]);
+    }
   }
   println();
-
-  return result;
+  if (screen.addressLines) {
+    print(F("Address lines: 0x"));
+    println(screen.addressLines, HEX);
+  }
+
+  // Full suite on the failing region only; the log starts over for it
+  uint16_t regionStart;
+  uint16_t regionLength;
+  QuickScreen::getRegion(screen, _run.start, _run.length, matrixBits, regionStart,
+                         regionLength);
+  print(F("Full suite on 0x"));
+  print(regionStart, HEX);
+  print(F("-0x"));
+  println(regionStart + regionLength - 1, HEX);
+  FaultLog.begin(_run.start, matrixBits, matrixBits);
+  _run.start = regionStart;
+  _run.length = regionLength;
+  return true;
 }
 
-TestResult RAMTestSuiteConsole::runMarchSSTest(uint16_t start, uint16_t length) {
-  uint8_t data;
-  INIT_TEST_RESULT;
-
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("March SS Test"));
+void RAMTestSuiteConsole::printVerdictTime() {
+  uint32_t elapsed = millis() - _run.runStarted;
   setTextColor(0xFFFF, 0x0000);  // White
-
-  // Phase 1: Up write 0
+  print(F("Time to verdict: "));
+  print(elapsed / 1000);
   print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, 0x00);
-  }
+  print((elapsed / 100) % 10);
+  println(F(" s"));
+}
 
-  // Phase 2: Up read 0, write 1
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0xFF);
+void RAMTestSuiteConsole::stepRun() {
+  if (_run.stepped) {
+    if (!stepTest()) {
+      _run.state = SUITE_RUN_DONE;
+    }
+    return;
   }
-
-  // Phase 3: Down read 1, write 0
-  print(F("."));
-  for (int16_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0xFF;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0x00);
+  if (_run.extendedActive) {
+    stepExtended();
+    return;
   }
 
-  // Phase 4: Down read 0, write 1
-  print(F("."));
-  for (int16_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0xFF);
+  uint8_t test = _scheduler.getTest();
+  if (test != _run.test) {
+    _run.test = test;
+    if (_scheduler.getFlags() & SUITE_RANDOM_PATTERN) {
+      _run.seed = _scheduler.getSeed();
+    }
+    const __FlashStringHelper *title = _scheduler.getTitle();
+    if (title && !_run.soaking) {
+      if (_run.titledTests > 0) {
+        println();
+      }
+      setProgressValue(5 + (uint16_t)test * 90 / RAM_TEST_SUITE_COUNT);
+      _run.led = (_run.titledTests & 1) ? COLOR_MAGENTA : COLOR_CYAN;
+      M1Shield.setLEDColor((LEDColor)_run.led);
+      setTextColor(0x07FF, 0x0000);  // Cyan
+      print(title);
+      if (_scheduler.getFlags() & SUITE_RANDOM_PATTERN) {
+        print(F(" seed 0x"));
+        print(_scheduler.getSeed(), HEX);
+      }
+      setTextColor(0xFFFF, 0x0000);  // White
+      _run.titledTests++;
+    }
   }
 
-  // Phase 5: Up read 1, write 0
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0xFF;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0x00);
+  // One dot per pass or delay, however many slices it takes
+  if (!_scheduler.isDone()) {
+    if (!_scheduler.isInPass() && !_run.soaking) {
+      print(F("."));
+    }
+    _scheduler.step(_run.result, SUITE_RUN_SLICE_CELLS);
   }
 
-  // Phase 6: Up read 0
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
+  // The companion's delays elapse while the first range keeps running; the
+  // log stays with the first range
+  bool companionDone = true;
+  if (_companion.icRefs) {
+    FaultLog.setPaused(true);
+    _companionScheduler.step(_companion.result, SUITE_RUN_SLICE_CELLS);
+    FaultLog.setPaused(false);
+    companionDone = _companionScheduler.isDone();
   }
-  println();
 
-  return result;
+  if (!_scheduler.isDone() || !companionDone) {
+    return;
+  }
+  if (_run.soaking) {
+    finishSoakPass();
+    return;
+  }
+  if (_run.composition && ++_run.pass < _run.composition->getPassCount()) {
+    // Next pass of a custom suite: the tests that still have runs left
+    println();
+    setTextColor(0xF81F, 0x0000);  // Magenta
+    print(F("--- Repeat "));
+    print(_run.pass + 1);
+    println(F(" ---"));
+    setTextColor(0xFFFF, 0x0000);  // White
+    _run.test = 0xFF;
+    _run.titledTests = 0;
+    _scheduler.setTestMask(_run.composition->getPassMask(_run.pass));
+    _scheduler.begin(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, _run.start, _run.length);
+    return;
+  }
+  if ((_run.extended & SUITE_EXTENDED_NPSF) && !_run.screening) {
+    println();
+    M1Shield.setLEDColor(COLOR_MAGENTA);
+    setTextColor(0x07FF, 0x0000);  // Cyan
+    print(F("NPSF (tiling)"));
+    setTextColor(0xFFFF, 0x0000);  // White
+    _run.extendedResult = {};
+    _npsf.begin(_run.start, _run.length, getMatrixBits(_run.start));
+    _run.extendedActive = true;
+    return;
+  }
+  finishRun();
 }
 
-TestResult RAMTestSuiteConsole::runMarchLATest(uint16_t start, uint16_t length) {
-  uint8_t data;
-  INIT_TEST_RESULT;
+void RAMTestSuiteConsole::finishSoakPass() {
+  _soak.addPass(_run.result);
+  uint16_t passes = _soak.getPasses();
+  uint32_t elapsed = millis() - _run.runStarted;
 
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("March LA Test"));
+  // One line per pass: errors and the chips that failed
   setTextColor(0xFFFF, 0x0000);  // White
-
-  // Phase 1: Up write 0
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, 0x00);
+  print(F("Pass "));
+  print(passes);
+  if (_run.seed) {
+    // Enough to replay the pass (DRAMSeedReplayConsole)
+    print(F(" seed 0x"));
+    print(_run.seed, HEX);
+  }
+  print(F(": "));
+  if (_run.result.totalErrors == 0) {
+    setTextColor(0x07E0, 0x0000);  // Green
+    println(F("OK"));
+  } else {
+    setTextColor(0xF800, 0x0000);  // Red
+    print(_run.result.totalErrors);
+    for (uint8_t b = 0; b < 8; b++) {
+      if (_run.result.bitErrors[b] > 0) {
+        print(F(" "));
+        print(_run.icRefs[b]);
+      }
+    }
+    println();
+    _run.led = COLOR_RED;
+    M1Shield.setLEDColor(COLOR_RED);
   }
+  setTextColor(0xFFFF, 0x0000);  // White
 
-  // Phase 2: Up read 0, write 1
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0xFF);
+  if ((_run.soakPasses && passes >= _run.soakPasses) ||
+      (_run.soakMillis && elapsed >= _run.soakMillis)) {
+    finishSoak();
+    return;
   }
-
-  // Phase 3: Down read 1, write 0
-  print(F("."));
-  for (int32_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0xFF;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0x00);
+  if (_run.soakPasses) {
+    setProgressValue((uint32_t)passes * 100 / _run.soakPasses);
+  } else if (_run.soakMillis) {
+    setProgressValue((uint32_t)((uint64_t)elapsed * 100 / _run.soakMillis));
   }
 
-  // Phase 4: Down read 0
-  print(F("."));
-  for (int32_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-  }
-  println();
-
-  return result;
+  _run.result = {};
+  _run.seed = 0;
+  _scheduler.begin(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, _run.start, _run.length);
 }
 
-TestResult RAMTestSuiteConsole::runReadDestructiveTest(uint16_t start, uint16_t length,
-                                                       uint8_t pattern, uint8_t numReads) {
-  uint8_t data;
-  INIT_TEST_RESULT;
+void RAMTestSuiteConsole::finishSoak() {
+  _run.state = SUITE_RUN_DONE;
+  uint32_t elapsed = millis() - _run.runStarted;
+  uint16_t passes = _soak.getPasses();
 
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Read Destructive Fault Test (pattern 0x"));
-  print(pattern, HEX);
-  print(F(", reads: "));
-  print(numReads);
-  print(F(")"));
-  setTextColor(0xFFFF, 0x0000);  // White
+  setProgressValue(100);
+  MemoryBus.endSession();
 
-  // 1. Fill memory with pattern
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, pattern);
-  }
+  cls();
+  println(F("--- Soak ---"));
+  print(passes);
+  print(F(" passes in "));
+  print(elapsed / 60000);
+  println(F(" min"));
 
-  // 2. Repeatedly read the same cell without re-writing
-  for (uint16_t i = 0; i < length; i++) {
-    for (uint8_t r = 0; r < numReads; r++) {
-      data = Model1.readMemory(start + i);
-      uint8_t diff = data ^ pattern;
-      UPDATE_ERRORS(diff);
-      if (diff != 0) {
-        break;
-      }
+  // Per chip: errors, failing passes, rate and behaviour
+  for (uint8_t b = 0; b < 8; b++) {
+    uint8_t state = _soak.getState(b);
+    setTextColor(0xFFFF, 0x0000);  // White
+    print(_run.icRefs[b]);
+    print(F(": "));
+    if (state == SOAK_BIT_CLEAN) {
+      setTextColor(0x07E0, 0x0000);  // Green
+      println(F("0"));
+      continue;
+    }
+    setTextColor(0xF800, 0x0000);  // Red
+    print(_soak.getErrors(b));
+    print(F(" ("));
+    print(_soak.getFailedPasses(b));
+    print(F("/"));
+    print(passes);
+    print(F(") "));
+    print(_soak.getErrorsPerHour(b, elapsed));
+    print(F("/h"));
+    if (state == SOAK_BIT_INTERMITTENT) {
+      setTextColor(0xFFE0, 0x0000);  // Yellow
+      println(F(" INTERMITTENT"));
+    } else {
+      println(F(" solid"));
     }
   }
-  println();
+  printAddressLines(_run.lines);
 
-  return result;
-}
+  TestResult total;
+  _soak.getTotal(total);
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("Total Errors: "));
+  if (total.totalErrors == 0) {
+    setTextColor(0x07E0, 0x0000);  // Green
+  } else {
+    setTextColor(0xF800, 0x0000);  // Red
+  }
+  println(total.totalErrors);
+  setTextColor(0xFFFF, 0x0000);  // White
 
-TestResult RAMTestSuiteConsole::runAddressUniquenessTest(uint16_t start, uint16_t length,
-                                                         uint8_t pattern) {
-  uint8_t data;
-  INIT_TEST_RESULT;
+  endTestRun(total, _run.icRefs);
+}
 
-  setTextColor(0x07FF, 0x0000);  // Cyan
-  print(F("Address Uniqueness Test (XOR pattern 0x"));
-  print(pattern, HEX);
-  print(F(")"));
-  setTextColor(0xFFFF, 0x0000);  // White
+void RAMTestSuiteConsole::stepExtended() {
+  // One transition per call; the fault log stays with the suite
+  FaultLog.setPaused(true);
+  _npsf.step(_run.extendedResult);
+  FaultLog.setPaused(false);
 
-  // Phase 1: Write unique XOR pattern
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    uint8_t value = ((uint8_t)(i & 0xFF)) ^ pattern;
-    Model1.writeMemory(start + i, value);
+  if ((_npsf.getStep() & 0x0F) == 0) {
+    print(F("."));
   }
-
-  // Phase 2: Verify
-  print(F("."));
-  for (uint16_t i = 0; i < length; i++) {
-    uint8_t expected = ((uint8_t)(i & 0xFF)) ^ pattern;
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ expected;
-    UPDATE_ERRORS(diff);
+  if (_npsf.isDone()) {
+    finishRun();
   }
-  println();
-
-  return result;
 }
 
-void RAMTestSuiteConsole::runAndEvaluate(uint16_t start, uint16_t length,
-                                         const char *const icRefs[]) {
-  Model1.activateTestSignal();
-  M1Shield.setLEDColor(COLOR_BLUE);  // Initialize test suite
-  setTextColor(0xFFFF, 0x0000);      // White
+void RAMTestSuiteConsole::finishRun() {
+  _run.state = SUITE_RUN_DONE;
+  println();
 
-  // Initialize aggregate totals - no intermediate storage needed
-  uint32_t totalBitErrors[8] = {};
-  uint32_t totalErrorsOverall = 0;
-
-  // Run comprehensive test suite and accumulate results directly
-  TestResult tempResult;
-
-  setProgressValue(5);
-  M1Shield.setLEDColor(COLOR_CYAN);  // Basic write tests
-  tempResult = runRepeatedWriteTest(start, length, true);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(10);
-  tempResult = runRepeatedWriteTest(start, length, false);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(15);
-  M1Shield.setLEDColor(COLOR_MAGENTA);  // Read tests
-  tempResult = runRepeatedReadTest(start, length, true);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(20);
-  tempResult = runRepeatedReadTest(start, length, false);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(25);
-  M1Shield.setLEDColor(COLOR_CYAN);  // Pattern tests
-  tempResult = runCheckerboardTest(start, length, true);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(30);
-  tempResult = runCheckerboardTest(start, length, false);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(35);
-  M1Shield.setLEDColor(COLOR_MAGENTA);  // Walking bit tests
-  tempResult = runWalkingOnesTest(start, length);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(40);
-  tempResult = runWalkingZerosTest(start, length);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(45);
-  M1Shield.setLEDColor(COLOR_CYAN);  // March tests (algorithmic)
-  tempResult = runMarchCTest(start, length);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(50);
-  M1Shield.setLEDColor(COLOR_MAGENTA);  // Moving inversion tests
-  tempResult = runMovingInversionTest(start, length, 0x00);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(55);
-  tempResult = runMovingInversionTest(start, length, 0x55);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(60);
-  tempResult = runMovingInversionTest(start, length, random(0, 255));
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(65);
-  M1Shield.setLEDColor(COLOR_CYAN);  // Advanced march tests
-  tempResult = runMarchSSTest(start, length);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(70);
-  tempResult = runMarchLATest(start, length);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(75);
-  M1Shield.setLEDColor(COLOR_MAGENTA);  // Destructive/stress tests
-  tempResult = runReadDestructiveTest(start, length, 0xAA, 5);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(80);
-  tempResult = runReadDestructiveTest(start, length, 0x55, 5);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(85);
-  M1Shield.setLEDColor(COLOR_CYAN);  // Address uniqueness tests
-  tempResult = runAddressUniquenessTest(start, length, 0x55);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(90);
-  tempResult = runAddressUniquenessTest(start, length, 0xAA);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
-
-  setProgressValue(95);
-  M1Shield.setLEDColor(COLOR_MAGENTA);  // Final retention test
-  tempResult = runRetentionTest(start, length, 0xFF, 1000, 5);
-  totalErrorsOverall += tempResult.totalErrors;
-  for (uint8_t b = 0; b < 8; b++)
-    totalBitErrors[b] += tempResult.bitErrors[b];
+  printSummary(_run.result, _run.icRefs, &_run.lines);
+
+  // Savings of the fused schedule over running every test on its own
+  print(F("Sweeps: "));
+  print(_scheduler.getSweeps());
+  print(F(" of "));
+  print(_scheduler.getNaiveSweeps());
+  print(F(", "));
+  print(_scheduler.getNaiveOperations() - _scheduler.getOperations());
+  println(F(" ops saved"));
+  if (_run.screening) {
+    print(F("Screen failed, suite on 0x"));
+    print(_run.start, HEX);
+    print(F("-0x"));
+    println(_run.start + _run.length - 1, HEX);
+  }
+  if (_companion.icRefs) {
+    printCompanionSummary();
+  }
+  if (_run.extendedActive) {
+    setTextColor(0xFFFF, 0x0000);  // White
+    println(F("--- NPSF ---"));
+    printChipErrors(_run.extendedResult, _run.icRefs);
+  }
+  printVerdictTime();
 
-  setProgressValue(100);
+  endTestRun(_run.result, _run.icRefs);
+  if ((_companion.icRefs && _companion.result.totalErrors > 0) ||
+      (_run.extendedActive && _run.extendedResult.totalErrors > 0)) {
+    M1Shield.setLEDColor(COLOR_RED);
+  }
+}
 
-  cls();
-  println(F("--- Summary ---"));
+void RAMTestSuiteConsole::printCompanionSummary() {
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("--- 0x"));
+  print(_companion.start, HEX);
+  print(F("-0x"));
+  print(_companion.start + _companion.length - 1, HEX);
+  println(F(" ---"));
+
+  printAddressLines(_companion.lines);
+  printChipErrors(_companion.result, _companion.icRefs);
+}
 
-  // Print per-bit totals using PROGMEM strings
+void RAMTestSuiteConsole::printChipErrors(const TestResult &result, const char *const icRefs[]) {
+  // Four chips per line
   for (uint8_t b = 0; b < 8; b++) {
     setTextColor(0xFFFF, 0x0000);  // White
-    print(F("Bit "));
-    print(b);
-    print(F(" ("));
     print(icRefs[b]);
-    print(F("): "));
-    if (totalBitErrors[b] == 0) {
+    print(F(": "));
+    if (result.bitErrors[b] == 0) {
       setTextColor(0x07E0, 0x0000);  // Green
     } else {
       setTextColor(0xF800, 0x0000);  // Red
     }
-    println(totalBitErrors[b]);
+    print(result.bitErrors[b]);
+    if ((b & 0x03) == 0x03) {
+      println();
+    } else {
+      print(F(" "));
+    }
   }
-  setTextColor(0xFFFF, 0x0000);  // White
 
+  setTextColor(0xFFFF, 0x0000);  // White
   print(F("Total Errors: "));
-  if (totalErrorsOverall == 0) {
+  if (result.totalErrors == 0) {
     setTextColor(0x07E0, 0x0000);  // Green
   } else {
     setTextColor(0xF800, 0x0000);  // Red
   }
-  println(totalErrorsOverall);
+  println(result.totalErrors);
   setTextColor(0xFFFF, 0x0000);  // White
+}
 
-  Model1.deactivateTestSignal();
+void RAMTestSuiteConsole::pauseRun() {
+  if (_run.state != SUITE_RUN_RUNNING) {
+    return;
+  }
 
-  // Final LED status indication based on test results
-  if (totalErrorsOverall == 0) {
-    // All tests passed
-    M1Shield.setLEDColor(COLOR_GREEN);
-  } else {
-    // Errors found
-    M1Shield.setLEDColor(COLOR_RED);
+  // Refresh keeps running, so memory holds its content while paused
+  _run.state = SUITE_RUN_PAUSED;
+  M1Shield.setLEDColor(COLOR_YELLOW);
+  notifyF(F("Paused - LF to resume"));
+}
+
+void RAMTestSuiteConsole::resumeRun() {
+  if (_run.state != SUITE_RUN_PAUSED) {
+    return;
+  }
+
+  _run.state = SUITE_RUN_RUNNING;
+  M1Shield.setLEDColor((LEDColor)_run.led);
+  notifyF(F("Resumed"));
+}
+
+void RAMTestSuiteConsole::cancelRun() {
+  if (_run.state == SUITE_RUN_RUNNING || _run.state == SUITE_RUN_PAUSED) {
+    if (_run.stepped) {
+      cancelTest();
+    }
+    MemoryBus.endSession();
+    Model1.deactivateTestSignal();
+    Globals.logger.infoF(F("RAM test suite canceled"));
+  }
+  _run.state = SUITE_RUN_IDLE;
+}
+
+Screen *RAMTestSuiteConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if ((action & BUTTON_RIGHT) && _run.state == SUITE_RUN_WAITING && !_run.screening) {
+    _run.extended ^= SUITE_EXTENDED_NPSF;
+    notifyF((_run.extended & SUITE_EXTENDED_NPSF) ? F("NPSF test added") : F("NPSF test removed"));
+  }
+
+  if (action & BUTTON_LEFT) {
+    if (_run.state == SUITE_RUN_PAUSED) {
+      resumeRun();
+    } else {
+      pauseRun();
+    }
+  }
+
+  return nullptr;
+}
+
+void RAMTestSuiteConsole::printAddressLines(const AddressLineResult &lines) {
+  // One character per line, A15 first: '.' ok, 'S' stuck, 'X' shorted, '-' not in range
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("A15-A0: "));
+  for (int8_t n = ADDRESS_LINES - 1; n >= 0; n--) {
+    switch (AddressLineTest::getState(lines, n)) {
+      case ADDRESS_LINE_OK:
+        setTextColor(0x07E0, 0x0000);  // Green
+        print(F("."));
+        break;
+      case ADDRESS_LINE_STUCK:
+        setTextColor(0xF800, 0x0000);  // Red
+        print(F("S"));
+        break;
+      case ADDRESS_LINE_SHORTED:
+        setTextColor(0xF800, 0x0000);  // Red
+        print(F("X"));
+        break;
+      default:
+        setTextColor(0xFFFF, 0x0000);  // White
+        print(F("-"));
+        break;
+    }
+  }
+  println();
+
+  for (uint8_t n = 0; n < ADDRESS_LINES; n++) {
+    uint8_t state = AddressLineTest::getState(lines, n);
+    if (state != ADDRESS_LINE_STUCK && state != ADDRESS_LINE_SHORTED) {
+      continue;
+    }
+    setTextColor(0xF800, 0x0000);  // Red
+    print(F("A"));
+    print(n);
+    if (state == ADDRESS_LINE_STUCK) {
+      println(F(": stuck/open"));
+    } else {
+      print(F(": shorted to A"));
+      println(lines.partner[n]);
+    }
+  }
+}
+
+void RAMTestSuiteConsole::printFaultPatterns(const char *const icRefs[]) {
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("Fault log: "));
+  print(FaultLog.getCount());
+  print(F(" of "));
+  println(FaultLog.getTotal());
+
+  // One line per failing chip, decoded into its row/column matrix
+  for (uint8_t b = 0; b < 8; b++) {
+    uint16_t address;
+    uint8_t pattern = FaultLog.classify(b, address);
+    if (pattern == FAULT_PATTERN_NONE) {
+      continue;
+    }
+
+    setTextColor(0xF800, 0x0000);  // Red
+    print(icRefs[b]);
+    print(F(": "));
+    switch (pattern) {
+      case FAULT_PATTERN_CELL:
+        print(F("cell r"));
+        print(FaultLog.getRow(address));
+        print(F(" c"));
+        print(FaultLog.getColumn(address));
+        break;
+      case FAULT_PATTERN_ROW:
+        print(F("row "));
+        print(FaultLog.getRow(address));
+        break;
+      case FAULT_PATTERN_COLUMN:
+        print(F("column "));
+        print(FaultLog.getColumn(address));
+        break;
+      default:
+        print(F("scattered"));
+        break;
+    }
+    print(F(" bank "));
+    print(FaultLog.getBank(address));
+    print(F(" @"));
+    println(address, HEX);
+  }
+
+  // First failure with the test it was found in
+  const FaultEntry &entry = FaultLog.getEntry(0);
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("First: "));
+  print(entry.address, HEX);
+  print(F(" exp "));
+  print(entry.expected, HEX);
+  print(F(" got "));
+  print(entry.actual, HEX);
+  print(F(" phase "));
+  println(FAULT_SOURCE_PHASE(entry.source));
+  const __FlashStringHelper *title = getSourceTitle(FAULT_SOURCE_TEST(entry.source));
+  if (title) {
+    println(title);
   }
 }
@@ -3,9 +3,61 @@
 
 #include <ConsoleScreen.h>
 
-struct TestResult {
-  uint32_t totalErrors;
-  uint32_t bitErrors[8];  // bitErrors[0] = failures of bit 0, etc.
+#include "../memory/AddressLineTest.h"
+#include "../memory/NpsfTest.h"
+#include "../memory/SoakStats.h"
+#include "../memory/SuiteComposition.h"
+#include "../memory/SweepScheduler.h"
+#include "../memory/TestResult.h"
+
+// Suite run states
+#define SUITE_RUN_IDLE 0
+#define SUITE_RUN_WAITING 1  // Intro shown, run starts after SUITE_RUN_START_DELAY_MS
+#define SUITE_RUN_RUNNING 2
+#define SUITE_RUN_PAUSED 3
+#define SUITE_RUN_DONE 4
+
+#define SUITE_RUN_START_DELAY_MS 5000
+#define SUITE_RUN_SLICE_CELLS 1024  // Cells per loop() call, keeps buttons and display responsive
+
+// Optional tests run after the suite, each with its own result
+#define SUITE_EXTENDED_NPSF 0x01  // Type-1 NPSF by tiling (NpsfTest)
+
+// Everything a suite run needs between two loop() calls
+struct SuiteRun {
+  TestResult result;           // Errors found so far
+  TestResult extendedResult;   // Errors of the extended tests
+  AddressLineResult lines;     // Address line probe of the run
+  const char *const *icRefs;   // Must outlive the run
+  uint32_t waitStarted;        // millis() the intro was shown
+  uint32_t runStarted;         // millis() the run started (time to verdict)
+  uint16_t startDelayMs;       // Intro time before the run starts
+  uint32_t testMask;           // Titled suite tests to run (SUITE_ALL_TESTS)
+  uint32_t soakMillis;         // Soak: stop after this time (0 = no limit)
+  uint16_t soakPasses;         // Soak: stop after this many passes (0 = no limit)
+  const SuiteComposition *composition;  // Passes of a custom suite; must outlive the run
+  uint16_t start;
+  uint16_t length;
+  uint8_t state;               // SUITE_RUN_*
+  uint8_t pass;                // Pass of the composition
+  uint8_t test;                // Suite entry of the last slice
+  uint8_t titledTests;         // Titled tests started
+  uint8_t led;                 // LEDColor of the running test
+  uint8_t extended;            // SUITE_EXTENDED_* tests to run after the suite
+  bool extendedActive;         // Suite done, extended tests running
+  bool screening;              // Quick screen first, full suite only on what failed
+  bool soaking;                // Suite looped pass after pass (SoakStats)
+  bool stepped;                // A subclass test (stepTest()) instead of the suite
+  uint16_t seed;               // Seed of the last random pattern test started
+};
+
+// Second range run in the same bus session, interleaved slice by slice
+struct SuiteCompanion {
+  TestResult result;
+  AddressLineResult lines;
+  const char *const *icRefs;  // nullptr = no companion; must outlive the run
+  uint16_t start;
+  uint16_t length;
 };
 
 struct TestSuiteResult {
@@ -34,29 +86,93 @@ class RAMTestSuiteConsole : public ConsoleScreen {
  public:
   RAMTestSuiteConsole();
 
+  void loop() override;
   void close() override;
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
 
-  // Public method for specialized test suites
+  // Public method for specialized test suites; the suite runs from loop() after the
+  // start delay. icRefs must stay valid for the whole run (static storage).
   void runSpecializedTest(uint16_t start, uint16_t length, const char *const icRefs[]);
 
+  // Same, but a quick screen decides first; the full suite only runs on the failing region
+  void runScreenedTest(uint16_t start, uint16_t length, const char *const icRefs[]);
+
+  // Extended tests run after the suite (SUITE_EXTENDED_*); RIGHT toggles
+  // NPSF while a run is waiting to start
+  void setExtendedTests(uint8_t extended);
+
+  // Loop the tests of testMask until maxPasses or maxMillis (whichever is set and
+  // reached first); no intro delay. stopSoak() ends it early with the passes done.
+  void runSoakTest(uint16_t start, uint16_t length, const char *const icRefs[],
+                   uint32_t testMask, uint16_t maxPasses, uint32_t maxMillis);
+  void stopSoak();
+  bool isSoakRunning() const;
+
+  // Replay: random pattern tests of the next run use seed, seed + stride, ...
+  // (one seed per test started) instead of fresh seeds; 0 = fresh seeds
+  void setReplaySeed(uint16_t seed, uint16_t stride);
+
+  // Only the tests of testMask and the given extended tests, without an intro delay
+  // (e.g. a TestPlanner plan); length is the range actually tested
+  void runSelectedTests(uint16_t start, uint16_t length, const char *const icRefs[],
+                        uint32_t testMask, uint8_t extended);
+
+  // Custom suite: every pass of the composition (see SuiteComposition) in one
+  // TEST activation, then its extended tests; no intro delay
+  void runComposedTest(uint16_t start, uint16_t length, const char *const icRefs[],
+                       const SuiteComposition &composition);
+
+  // Suite on two chip sets at once without an intro delay: one TEST activation
+  // and bus session, the companion range gets a slice after every slice of the
+  // first. The fault log decodes the first range; both get per-IC reports.
+  void runCombinedTest(uint16_t start, uint16_t length, const char *const icRefs[],
+                       uint16_t companionStart, uint16_t companionLength,
+                       const char *const companionIcRefs[]);
+
  protected:
   void runAndEvaluate(uint16_t start, uint16_t length, const char *const icRefs[]);
 
+  // Test modes with their own steps run like the suite: intro delay, TEST
+  // signal and bus session, then beginTest() once and stepTest() from every
+  // loop() until it returns false (it reports and calls endTestRun() itself).
+  // Leaving the screen calls cancelTest() before the session ends.
+  void runSteppedTest(uint16_t start, const char *const icRefs[]);
+  virtual bool beginTest();  // false ends the run (bus session and TEST released)
+  virtual bool stepTest();
+  virtual void cancelTest();
+
+  // Suite run control (LEFT toggles pause, leaving the screen cancels)
+  void pauseRun();
+  void resumeRun();
+  void cancelRun();
+
+  // Building blocks for test modes: TEST signal and bus session, summary, final status
+  bool beginTestRun(uint16_t start);
+  void printSummary(const TestResult &result, const char *const icRefs[],
+                    const AddressLineResult *lines = nullptr);
+  void endTestRun(const TestResult &result, const char *const icRefs[]);
+
  private:
-  TestResult runRepeatedWriteTest(uint16_t start, uint16_t length, bool toggleStart);
-  TestResult runRepeatedReadTest(uint16_t start, uint16_t length, bool toggleStart);
-  TestResult runCheckerboardTest(uint16_t start, uint16_t length, bool toggleStart);
-  TestResult runWalkingOnesTest(uint16_t start, uint16_t length);
-  TestResult runWalkingZerosTest(uint16_t start, uint16_t length);
-  TestResult runMarchCTest(uint16_t start, uint16_t length);
-  TestResult runMovingInversionTest(uint16_t start, uint16_t length, uint8_t pattern);
-  TestResult runRetentionTest(uint16_t start, uint16_t length, uint8_t pattern, uint32_t delayMs,
-                              uint8_t repeatDelay);
-  TestResult runMarchSSTest(uint16_t start, uint16_t length);
-  TestResult runMarchLATest(uint16_t start, uint16_t length);
-  TestResult runReadDestructiveTest(uint16_t start, uint16_t length, uint8_t pattern,
-                                    uint8_t numReads);
-  TestResult runAddressUniquenessTest(uint16_t start, uint16_t length, uint8_t pattern);
+  SuiteRun _run;
+  SweepScheduler _scheduler;
+  SuiteCompanion _companion;
+  SweepScheduler _companionScheduler;
+  NpsfTest _npsf;
+  SoakStats _soak;
+
+  void runAddressLines(uint16_t start, uint16_t length, AddressLineResult &lines,
+                       TestResult &result);
+  bool screenRun();
+  void stepRun();
+  void stepExtended();
+  void finishSoakPass();
+  void finishSoak();
+  void finishRun();
+  void printVerdictTime();
+  void printCompanionSummary();
+  void printChipErrors(const TestResult &result, const char *const icRefs[]);
+  void printFaultPatterns(const char *const icRefs[]);
+  void printAddressLines(const AddressLineResult &lines);
 };
 
 #endif  // RAM_TEST_SUITE_CONSOLE_H
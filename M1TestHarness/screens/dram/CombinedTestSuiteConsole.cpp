@@ -0,0 +1,65 @@
+#include "./CombinedTestSuiteConsole.h"
+
+#include <Arduino.h>
+
+#include "../../globals.h"
+#include "../../memory/DramTopology.h"
+#include "../video/VRAMTestSuiteConsole.h"
+#include "./DRAMMenu.h"
+
+CombinedTestSuiteConsole::CombinedTestSuiteConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM+VRAM Tests"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("LF:Pause")};
+  setButtonItemsF(buttons, 2);
+}
+
+void CombinedTestSuiteConsole::_executeOnce() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM + VRAM TEST SUITE ==="));
+  println();
+
+  // Get current DRAM size from globals
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+
+  // Validate DRAM size
+  if (dramSizeKB == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: DRAM size not configured"));
+    println(F("Please run Hardware Detection first"));
+    Globals.logger.errF(F("Combined test attempted with zero DRAM size"));
+    return;
+  }
+
+  setTextColor(0xFFFF, 0x0000);
+  print(F("DRAM 0x4000-0x"));
+  print(0x4000 + (dramSizeKB * 1024) - 1, HEX);
+  print(F(" ("));
+  print(dramSizeKB);
+  println(F("KB)"));
+  println(F("VRAM 0x3C00-0x3FFF (1KB)"));
+
+  setTextColor(0xF800, 0x0000);  // Red
+  println(F("WARNING: Screen may flicker during"));
+  println(F("video memory testing!"));
+  println();
+
+  // DRAM is the primary range (fault log), VRAM runs interleaved with it
+  const uint16_t dramStart = 0x4000;
+  const uint16_t dramLength = dramSizeKB * 1024;
+
+  runCombinedTest(dramStart, dramLength, DRAM_IC_REFS, 0x3C00, 1024, VRAM_IC_REFS);
+}
+
+Screen *CombinedTestSuiteConsole::actionTaken(ActionTaken action, int8_t offsetX,
+                                              int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+
+  return RAMTestSuiteConsole::actionTaken(action, offsetX, offsetY);
+}
@@ -0,0 +1,33 @@
+#ifndef COMBINED_TEST_SUITE_CONSOLE_H
+#define COMBINED_TEST_SUITE_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * CombinedTestSuiteConsole - DRAM and video RAM tested in one run
+ *
+ * Runs the RAM test suite on the DRAM (0x4000+, Z13-Z20) and the video RAM
+ * (0x3C00-0x3FFF, Z45-Z63) interleaved, slice by slice, in a single bus
+ * session. Compared to the DRAM and VRAM suites run one after the other this
+ * saves the second setup, intro delay and TEST signal toggle, and the delays
+ * of one suite overlap with the sweeps of the other.
+ *
+ * IC References:
+ * - DRAM: Z17, Z16, Z18, Z19, Z15, Z20, Z14, Z13
+ * - VRAM: Z48, Z47, Z46, Z45, Z61, Z62, Z?, Z63
+ *
+ * Features:
+ * - Per-IC reports for both chip sets from one run
+ * - Fault pattern decoding for the DRAM
+ * - Starts immediately, pause and cancel as in the single suites
+ */
+class CombinedTestSuiteConsole : public RAMTestSuiteConsole {
+ public:
+  CombinedTestSuiteConsole();
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+};
+
+#endif  // COMBINED_TEST_SUITE_CONSOLE_H
@@ -0,0 +1,89 @@
+#include "./DRAMCustomSuiteConsole.h"
+
+#include <Arduino.h>
+
+#include "../../globals.h"
+#include "../../memory/DramTopology.h"
+#include "./DRAMSuiteComposerMenu.h"
+
+DRAMCustomSuiteConsole::DRAMCustomSuiteConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("Custom DRAM Suite"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  _composition.load();
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Back"), F("LF:Pause")};
+  setButtonItemsF(buttons, 2);
+}
+
+void DRAMCustomSuiteConsole::_executeOnce() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== CUSTOM DRAM SUITE ==="));
+  println();
+
+  // Get current DRAM size from globals
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+
+  // Validate DRAM size
+  if (dramSizeKB == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: DRAM size not configured"));
+    println(F("Please run Hardware Detection first"));
+    Globals.logger.errF(F("Custom DRAM suite attempted with zero DRAM size"));
+    return;
+  }
+
+  const uint16_t start = _composition.getStart(0x4000);
+  const uint16_t length = _composition.getLength(dramSizeKB);
+  if (length == 0 || _composition.getPassCount() == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Nothing to test"));
+    println(F("Select tests and a range in the"));
+    println(F("Custom DRAM Suite menu"));
+    return;
+  }
+
+  print(F("Memory Range: 0x"));
+  print(start, HEX);
+  print(F("-0x"));
+  println(start + length - 1, HEX);
+
+  uint8_t tests = getSuiteTitledCount(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT);
+  setTextColor(0x07FF, 0x0000);  // Cyan
+  for (uint8_t n = 0; n < tests; n++) {
+    uint8_t runs = _composition.getRuns(n);
+    if (runs == 0) {
+      continue;
+    }
+    print(F(" "));
+    print(getSuiteTitle(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, n));
+    if (runs > 1) {
+      print(F(" x"));
+      print(runs);
+    }
+    println();
+  }
+
+  // NPSF tiles whole 4116 matrices only
+  if (_composition.npsf && (length % 16384 != 0)) {
+    _composition.npsf = false;
+    setTextColor(0xFFE0, 0x0000);  // Yellow
+    println(F(" NPSF skipped: needs whole 16KB banks"));
+  } else if (_composition.npsf) {
+    println(F(" NPSF (tiling)"));
+  }
+  println();
+
+  runComposedTest(start, length, DRAM_IC_REFS, _composition);
+}
+
+Screen *DRAMCustomSuiteConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMSuiteComposerMenu();
+  }
+
+  return RAMTestSuiteConsole::actionTaken(action, offsetX, offsetY);
+}
@@ -0,0 +1,27 @@
+#ifndef DRAM_CUSTOM_SUITE_CONSOLE_H
+#define DRAM_CUSTOM_SUITE_CONSOLE_H
+
+#include "../../memory/SuiteComposition.h"
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMCustomSuiteConsole - Runs the custom DRAM suite stored in EEPROM
+ *
+ * Lists the composition (tests with their runs, range, NPSF) and runs all
+ * of its passes as one batch (see RAMTestSuiteConsole::runComposedTest).
+ * MENU returns to the composer.
+ */
+class DRAMCustomSuiteConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMCustomSuiteConsole();
+
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+
+ private:
+  SuiteComposition _composition;  // Outlives the run
+};
+
+#endif  // DRAM_CUSTOM_SUITE_CONSOLE_H
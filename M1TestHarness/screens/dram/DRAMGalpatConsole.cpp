@@ -0,0 +1,152 @@
+#include "./DRAMGalpatConsole.h"
+
+#include <Arduino.h>
+#include <M1Shield.h>
+#include <Model1.h>
+
+#include "../../globals.h"
+#include "../../memory/GalpatTest.h"
+#include "../../memory/MemoryBus.h"
+#include "./DRAMMenu.h"
+
+DRAMGalpatConsole::DRAMGalpatConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM GALPAT"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  _banks = 0;
+  _window = GALPAT_DEFAULT_WINDOW;
+  _opsPerSecond = 0;
+  _ready = false;
+  _startRequested = false;
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("U/D:Window"), F("RT:Start")};
+  setButtonItemsF(buttons, 3);
+}
+
+void DRAMGalpatConsole::_executeOnce() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM GALPAT TEST ==="));
+  println();
+
+  // Only complete banks of 4116s have the full 128 x 128 matrix
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+  _banks = dramSizeKB / 16;
+  if (_banks == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Needs at least 16KB of DRAM"));
+    println(F("(one bank of 4116 chips)"));
+    Globals.logger.errF(F("DRAM GALPAT test attempted with %d KB"), dramSizeKB);
+    return;
+  }
+
+  // Bus rate of the gallop itself; memory content is kept
+  Model1.activateTestSignal();
+  if (MemoryBus.beginSession()) {
+    _opsPerSecond = GalpatTest::measureOpsPerSecond(0x4000, GALPAT_DEFAULT_WINDOW);
+    MemoryBus.endSession();
+  }
+  Model1.deactivateTestSignal();
+
+  _ready = true;
+  printIntro();
+}
+
+void DRAMGalpatConsole::printIntro() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM GALPAT TEST ==="));
+  println();
+  print(F("Testing "));
+  print(_banks);
+  println(F(" bank(s) of 128 x 128 cells"));
+  println(F("Each cell galloped against its"));
+  print(F("row/column neighbours, window "));
+  println(_window);
+  println(F("IC References: Z17,Z16,Z18,Z19,Z15,Z20,Z14,Z13"));
+  println();
+
+  print(F("Bus operations: "));
+  println(GalpatTest::getOperations(_window, _banks));
+  print(F("Estimated time: "));
+  if (_opsPerSecond == 0) {
+    println(F("unknown"));
+  } else {
+    uint32_t estimate = GalpatTest::getEstimatedMillis(_window, _banks, _opsPerSecond);
+    print(estimate / 1000);
+    println(F(" s"));
+  }
+  println();
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("UP/DOWN: window, RIGHT: start"));
+  setTextColor(0xFFFF, 0x0000);  // White
+}
+
+void DRAMGalpatConsole::loop() {
+  RAMTestSuiteConsole::loop();
+
+  if (_startRequested) {
+    _startRequested = false;
+    runGalpat();
+  }
+}
+
+void DRAMGalpatConsole::runGalpat() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+
+  const uint16_t start = 0x4000;  // DRAM start address
+
+  if (!beginTestRun(start)) {
+    return;
+  }
+
+  setProgressValue(5);
+  M1Shield.setLEDColor(COLOR_CYAN);
+  setTextColor(0x07FF, 0x0000);  // Cyan
+  print(F("GALPAT window "));
+  print(_window);
+  setTextColor(0xFFFF, 0x0000);  // White
+
+  INIT_TEST_RESULT;
+  uint32_t started = millis();
+  GalpatTest::run(start, _banks, _window, result, this);
+  uint32_t elapsed = millis() - started;
+
+  printSummary(result, DRAM_IC_REFS);
+  print(F("Time: "));
+  print(elapsed / 1000);
+  if (_opsPerSecond != 0) {
+    print(F(" s (estimated "));
+    print(GalpatTest::getEstimatedMillis(_window, _banks, _opsPerSecond) / 1000);
+    println(F(" s)"));
+  } else {
+    println(F(" s"));
+  }
+  endTestRun(result, DRAM_IC_REFS);
+}
+
+Screen *DRAMGalpatConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+  if (!_ready) {
+    return nullptr;
+  }
+
+  if ((action & BUTTON_UP) && _window < GALPAT_MAX_WINDOW) {
+    _window++;
+    printIntro();
+  } else if ((action & BUTTON_DOWN) && _window > 1) {
+    _window--;
+    printIntro();
+  } else if (action & BUTTON_RIGHT) {
+    _ready = false;
+    _startRequested = true;
+  }
+
+  return nullptr;
+}
@@ -0,0 +1,37 @@
+#ifndef DRAM_GALPAT_CONSOLE_H
+#define DRAM_GALPAT_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMGalpatConsole - Windowed GALPAT coupling test on the DRAM matrix
+ *
+ * Gallops every DRAM cell against its row and column neighbours in the 4116
+ * matrix (see GalpatTest). The window (neighbours per direction) is chosen
+ * with UP/DOWN before the test is started with RIGHT; the estimated run time
+ * for the window is shown from a short bus rate measurement.
+ *
+ * Only complete 16KB banks of 4116s are tested.
+ */
+class DRAMGalpatConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMGalpatConsole();
+
+  void loop() override;
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+
+ private:
+  uint8_t _banks;
+  uint8_t _window;
+  uint32_t _opsPerSecond;
+  bool _ready;           // Intro shown, waiting for RIGHT
+  bool _startRequested;  // Run on the next loop()
+
+  void printIntro();
+  void runGalpat();
+};
+
+#endif  // DRAM_GALPAT_CONSOLE_H
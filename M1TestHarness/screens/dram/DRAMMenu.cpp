@@ -4,8 +4,19 @@
 
 #include "../../globals.h"
 #include "../MainMenu.h"
+#include "./CombinedTestSuiteConsole.h"
 #include "./DRAMContentViewerConsole.h"
+#include "./DRAMGalpatConsole.h"
+#include "./DRAMPlannerConsole.h"
+#include "./DRAMRefreshConsole.h"
+#include "./DRAMRetentionConsole.h"
+#include "./DRAMRowHammerConsole.h"
+#include "./DRAMSeedReplayConsole.h"
+#include "./DRAMSoakConsole.h"
+#include "./DRAMSuiteComposerMenu.h"
 #include "./DRAMTestSuiteConsole.h"
+#include "./DRAMTimingConsole.h"
+#include "./DRAMTopologyConsole.h"
 
 // Static buffer for dynamic string formatting
 char DRAMMenu::_configBuffer[16];
@@ -15,8 +26,14 @@ DRAMMenu::DRAMMenu() : MenuScreen() {
 
   // Create menu items for DRAM features - copy from PROGMEM
   const __FlashStringHelper *menuItems[] = {F("Memory Size"), F("DRAM Viewer"),
-                                            F("DRAM Test Suite")};
-  setMenuItemsF(menuItems, 3);
+                                            F("DRAM Test Suite"), F("DRAM Topology Test"),
+                                            F("DRAM Retention Test"), F("DRAM Quick Screen"),
+                                            F("DRAM+VRAM Test Suite"), F("DRAM GALPAT Test"),
+                                            F("DRAM Row Hammer"), F("DRAM Soak Test"),
+                                            F("DRAM Time-Budget Plan"), F("DRAM Refresh Sweep"),
+                                            F("DRAM Timing Margin"), F("Custom DRAM Suite"),
+                                            F("DRAM Seed Replay")};
+  setMenuItemsF(menuItems, 15);
 
   // Initialize DRAM size values - will be set properly in open()
   _currentDRAMSizeKB = 0;
@@ -45,6 +62,42 @@ Screen *DRAMMenu::_getSelectedMenuItemScreen(int index) {
     case 2:  // DRAM Test Suite
       return new DRAMTestSuiteConsole();
 
+    case 3:  // DRAM Topology Test
+      return new DRAMTopologyConsole();
+
+    case 4:  // DRAM Retention Test
+      return new DRAMRetentionConsole();
+
+    case 5:  // DRAM Quick Screen
+      return new DRAMTestSuiteConsole(true);
+
+    case 6:  // DRAM+VRAM Test Suite
+      return new CombinedTestSuiteConsole();
+
+    case 7:  // DRAM GALPAT Test
+      return new DRAMGalpatConsole();
+
+    case 8:  // DRAM Row Hammer
+      return new DRAMRowHammerConsole();
+
+    case 9:  // DRAM Soak Test
+      return new DRAMSoakConsole();
+
+    case 10:  // DRAM Time-Budget Plan
+      return new DRAMPlannerConsole();
+
+    case 11:  // DRAM Refresh Sweep
+      return new DRAMRefreshConsole();
+
+    case 12:  // DRAM Timing Margin
+      return new DRAMTimingConsole();
+
+    case 13:  // Custom DRAM Suite
+      return new DRAMSuiteComposerMenu();
+
+    case 14:  // DRAM Seed Replay
+      return new DRAMSeedReplayConsole();
+
     case -1:  // Back
       return new MainMenu();
 
@@ -0,0 +1,154 @@
+#include "./DRAMPlannerConsole.h"
+
+#include <Arduino.h>
+#include <Model1.h>
+
+#include "../../globals.h"
+#include "../../memory/DramTopology.h"
+#include "../../memory/MemoryBus.h"
+#include "./DRAMMenu.h"
+
+// Time budgets in seconds
+static const uint16_t PLAN_BUDGETS[] PROGMEM = {15, 30, 60, 120, 300, 600};
+static const uint8_t PLAN_BUDGET_CHOICES = sizeof(PLAN_BUDGETS) / sizeof(PLAN_BUDGETS[0]);
+
+DRAMPlannerConsole::DRAMPlannerConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM Planner"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  _plan = {};
+  _opsPerSecond = 0;
+  _length = 0;
+  _budgetChoice = 2;  // 60 s
+  _ready = false;
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("U/D:Budget"), F("RT:Start")};
+  setButtonItemsF(buttons, 3);
+}
+
+void DRAMPlannerConsole::_executeOnce() {
+  // Get current DRAM size from globals
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+
+  // Validate DRAM size
+  if (dramSizeKB == 0) {
+    cls();
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: DRAM size not configured"));
+    println(F("Please run Hardware Detection first"));
+    Globals.logger.errF(F("DRAM planner attempted with zero DRAM size"));
+    return;
+  }
+  _length = dramSizeKB * 1024;
+
+  // Bus rate of this unit; memory content is kept
+  Model1.activateTestSignal();
+  if (MemoryBus.beginSession()) {
+    _opsPerSecond = TestPlanner::measureOpsPerSecond(0x4000);
+    MemoryBus.endSession();
+  }
+  Model1.deactivateTestSignal();
+
+  if (_opsPerSecond == 0) {
+    cls();
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Unable to access memory bus"));
+    return;
+  }
+
+  _ready = true;
+  printPlan();
+}
+
+void DRAMPlannerConsole::printPlan() {
+  uint16_t budget = pgm_read_word(&PLAN_BUDGETS[_budgetChoice]);
+  TestPlanner::plan(_length, budget * 1000UL, _opsPerSecond, _plan);
+
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("=== DRAM PLAN: "));
+  print(budget);
+  println(F(" s ==="));
+  print(F("Bus rate: "));
+  print(_opsPerSecond);
+  println(F(" ops/s"));
+  print(F("Range: 0x4000-0x"));
+  print(0x4000 + _plan.length - 1, HEX);
+  if (_plan.length < _length) {
+    setTextColor(0xFFE0, 0x0000);  // Yellow
+    print(F(" (shortened)"));
+    setTextColor(0xFFFF, 0x0000);  // White
+  }
+  println();
+
+  setTextColor(0x07FF, 0x0000);  // Cyan
+  uint8_t tests = getSuiteTitledCount(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT);
+  for (uint8_t n = 0; n < tests; n++) {
+    if (_plan.testMask & (1UL << n)) {
+      print(F(" "));
+      println(getSuiteTitle(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, n));
+    }
+  }
+  if (_plan.npsf) {
+    println(F(" NPSF (tiling)"));
+  }
+  setTextColor(0xFFFF, 0x0000);  // White
+
+  print(F("Covers: "));
+  printFaults(_plan.coverage);
+  if (_plan.coverage != PLAN_FAULT_ALL) {
+    setTextColor(0xFFE0, 0x0000);  // Yellow
+    print(F("Misses: "));
+    printFaults(~_plan.coverage);
+    setTextColor(0xFFFF, 0x0000);  // White
+  }
+  print(F("ETA: "));
+  print((_plan.estimatedMillis + 999) / 1000);
+  println(F(" s"));
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("UP/DOWN: budget, RIGHT: start"));
+  setTextColor(0xFFFF, 0x0000);  // White
+}
+
+void DRAMPlannerConsole::printFaults(uint8_t faults) {
+  bool first = true;
+  for (uint8_t b = 0; b < 8; b++) {
+    if (faults & (1 << b)) {
+      if (!first) {
+        print(F(", "));
+      }
+      print(TestPlanner::getFaultName(1 << b));
+      first = false;
+    }
+  }
+  println();
+}
+
+Screen *DRAMPlannerConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+  if (!_ready) {
+    return RAMTestSuiteConsole::actionTaken(action, offsetX, offsetY);
+  }
+
+  if ((action & BUTTON_UP) && _budgetChoice + 1 < PLAN_BUDGET_CHOICES) {
+    _budgetChoice++;
+    printPlan();
+  } else if ((action & BUTTON_DOWN) && _budgetChoice > 0) {
+    _budgetChoice--;
+    printPlan();
+  } else if (action & BUTTON_RIGHT) {
+    _ready = false;
+    const __FlashStringHelper *buttons[] = {F("M:Menu"), F("LF:Pause")};
+    setButtonItemsF(buttons, 2);
+
+    runSelectedTests(0x4000, _plan.length, DRAM_IC_REFS, _plan.testMask,
+                     _plan.npsf ? SUITE_EXTENDED_NPSF : 0);
+  }
+
+  return nullptr;
+}
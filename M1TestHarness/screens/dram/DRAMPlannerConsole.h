@@ -0,0 +1,35 @@
+#ifndef DRAM_PLANNER_CONSOLE_H
+#define DRAM_PLANNER_CONSOLE_H
+
+#include "../../memory/TestPlanner.h"
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMPlannerConsole - Best DRAM diagnosis within a time budget
+ *
+ * Measures the bus rate of this unit, lets TestPlanner choose the suite tests
+ * (and, on short budgets, a shorter range) for the budget picked with
+ * UP/DOWN, and shows the plan with its coverage and estimated time. RIGHT
+ * runs the plan as one suite run.
+ */
+class DRAMPlannerConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMPlannerConsole();
+
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+
+ private:
+  TestPlan _plan;
+  uint32_t _opsPerSecond;
+  uint16_t _length;
+  uint8_t _budgetChoice;
+  bool _ready;  // Plan shown, waiting for RIGHT
+
+  void printPlan();
+  void printFaults(uint8_t faults);
+};
+
+#endif  // DRAM_PLANNER_CONSOLE_H
@@ -0,0 +1,164 @@
+#include "./DRAMRefreshConsole.h"
+
+#include <Arduino.h>
+#include <M1Shield.h>
+#include <Model1.h>
+
+#include "../../globals.h"
+#include "../../memory/DramTopology.h"
+#include "../../memory/MemoryBus.h"
+#include "../../memory/RefreshSweep.h"
+#include "./DRAMMenu.h"
+
+// Chips holding less than this multiple of the default interval are reported as weak
+#define WEAK_REFRESH_FACTOR 4
+
+DRAMRefreshConsole::DRAMRefreshConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM Refresh"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu")};
+  setButtonItemsF(buttons, 1);
+}
+
+void DRAMRefreshConsole::_executeOnce() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM REFRESH SWEEP ==="));
+  println();
+
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+  if (dramSizeKB == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: DRAM size not configured"));
+    println(F("Please run Hardware Detection first"));
+    Globals.logger.errF(F("DRAM refresh sweep attempted with zero DRAM size"));
+    return;
+  }
+
+  uint32_t defaultMicros = RefreshSweep::getDefaultMicros();
+  if (defaultMicros == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Refresh timer is not running"));
+    Globals.logger.errF(F("DRAM refresh sweep without Timer2 refresh"));
+    return;
+  }
+
+  uint16_t length = dramSizeKB * 1024;
+  print(F("Refresh interrupt every "));
+  print(defaultMicros);
+  println(F(" us"));
+  println(F("Stretched step by step; DRAM is"));
+  println(F("verified with 0xFF and 0x00 at each"));
+  print(F("Takes at most "));
+  print(RefreshSweep::getMaxDurationMillis(length) / 1000);
+  println(F(" s"));
+  println();
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("Starting DRAM refresh sweep..."));
+  println();
+
+  _length = length;
+  _defaultMicros = defaultMicros;
+  runSteppedTest(0x4000, DRAM_IC_REFS);  // DRAM start address
+}
+
+bool DRAMRefreshConsole::beginTest() {
+  setProgressValue(5);
+  M1Shield.setLEDColor(COLOR_CYAN);
+  setTextColor(0x07FF, 0x0000);  // Cyan
+  print(F("Stretching refresh"));
+  setTextColor(0xFFFF, 0x0000);  // White
+
+  _step = 0;
+  _started = millis();
+  if (!RefreshSweep::begin(0x4000, _length)) {
+    cls();
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Refresh timer is not running"));
+    M1Shield.setLEDColor(COLOR_RED);
+    return false;
+  }
+  return true;
+}
+
+bool DRAMRefreshConsole::stepTest() {
+  if (!RefreshSweep::isDone()) {
+    RefreshSweep::step();
+    if (RefreshSweep::getStep() != _step) {
+      _step = RefreshSweep::getStep();
+      setProgressValue(5 + (uint16_t)_step * 90 / REFRESH_SWEEP_MAX_STEPS);
+      print(F("."));
+    }
+    return true;
+  }
+
+  uint32_t elapsed = millis() - _started;
+  println();
+  setProgressValue(100);
+  MemoryBus.endSession();
+  Model1.deactivateTestSignal();
+  printResults(elapsed);
+  return false;
+}
+
+void DRAMRefreshConsole::cancelTest() {
+  // Default refresh back before the bus session ends
+  RefreshSweep::cancel();
+}
+
+void DRAMRefreshConsole::printResults(uint32_t elapsed) {
+  uint32_t defaultMicros = _defaultMicros;
+
+  cls();
+  println(F("--- Refresh Margin ---"));
+  print(F("Tested up to "));
+  print(RefreshSweep::getStepMicros(RefreshSweep::getStepCount() - 1));
+  println(F(" us"));
+
+  // Slowest interval at which each chip kept its data
+  bool failed = false;
+  for (uint8_t b = 0; b < 8; b++) {
+    setTextColor(0xFFFF, 0x0000);  // White
+    print(F("Bit "));
+    print(b);
+    print(F(" ("));
+    print(DRAM_IC_REFS[b]);
+    print(F("): "));
+
+    uint32_t held = RefreshSweep::getBitHeldMicros(b);
+    if (held == 0) {
+      setTextColor(0xF800, 0x0000);  // Red
+      println(F("fails at default"));
+      failed = true;
+      continue;
+    }
+    uint32_t factor = held / defaultMicros;
+    setTextColor((factor < WEAK_REFRESH_FACTOR) ? 0xFFE0 : 0x07E0, 0x0000);  // Yellow / Green
+    if (RefreshSweep::getBitFailStep(b) == REFRESH_SWEEP_HELD) {
+      print(F(">="));
+    }
+    print(held);
+    print(F(" us ("));
+    print(factor);
+    println(F("x)"));
+  }
+
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("Time: "));
+  print(elapsed / 1000);
+  println(F(" s"));
+
+  M1Shield.setLEDColor(failed ? COLOR_RED : COLOR_GREEN);
+}
+
+Screen *DRAMRefreshConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+
+  return nullptr;
+}
@@ -0,0 +1,35 @@
+#ifndef DRAM_REFRESH_CONSOLE_H
+#define DRAM_REFRESH_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMRefreshConsole - Refresh interval margin of every DRAM chip
+ *
+ * Stretches the harness refresh interval step by step and re-verifies DRAM
+ * at each step (see RefreshSweep). Shows, per chip, the slowest refresh it
+ * still held data at, as an interval and as a multiple of the default. The
+ * sweep runs in small steps from loop(); the refresh timer is restored
+ * before the results are shown, or at once when MENU cancels it.
+ */
+class DRAMRefreshConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMRefreshConsole();
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+  bool beginTest() override;
+  bool stepTest() override;
+  void cancelTest() override;
+
+ private:
+  uint16_t _length;
+  uint32_t _defaultMicros;
+  uint8_t _step;       // Step whose dot is shown
+  uint32_t _started;   // millis() the sweep started
+
+  void printResults(uint32_t elapsed);
+};
+
+#endif  // DRAM_REFRESH_CONSOLE_H
@@ -0,0 +1,217 @@
+#include "./DRAMRetentionConsole.h"
+
+#include <Arduino.h>
+#include <M1Shield.h>
+#include <Model1.h>
+
+#include "../../globals.h"
+#include "../../memory/MemoryBus.h"
+#include "../../memory/RetentionTest.h"
+#include "./DRAMMenu.h"
+
+// Rows shorter than this many steps are reported as weak
+#define WEAK_ROW_STEPS 4
+
+DRAMRetentionConsole::DRAMRetentionConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM Retention"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu")};
+  setButtonItemsF(buttons, 1);
+}
+
+void DRAMRetentionConsole::_executeOnce() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM RETENTION TEST ==="));
+  println();
+
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+  uint8_t banks = dramSizeKB / 16;
+  if (banks == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Needs at least 16KB of DRAM"));
+    println(F("(one bank of 4116 chips)"));
+    Globals.logger.errF(F("DRAM retention test attempted with %d KB"), dramSizeKB);
+    return;
+  }
+
+  const uint16_t stepMs = RETENTION_DEFAULT_STEP_MS;
+  setTextColor(0xFFFF, 0x0000);
+  print(F("Testing "));
+  print(banks * DRAM_ROWS);
+  println(F(" rows with refresh disabled"));
+  print(F("Resolution "));
+  print(stepMs);
+  print(F(" ms, up to "));
+  print((uint32_t)RETENTION_MAX_STEPS * stepMs);
+  println(F(" ms"));
+  print(F("Takes at most "));
+  print(RetentionTest::getMaxDurationMillis(stepMs) / 1000);
+  println(F(" s"));
+  println();
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("Starting DRAM retention test..."));
+  println();
+
+  _banks = banks;
+  runSteppedTest(0x4000, DRAM_IC_REFS);  // DRAM start address
+}
+
+bool DRAMRetentionConsole::beginTest() {
+  setProgressValue(5);
+  M1Shield.setLEDColor(COLOR_CYAN);
+  setTextColor(0x07FF, 0x0000);  // Cyan
+  print(F("Searching hold times"));
+  setTextColor(0xFFFF, 0x0000);  // White
+
+  _round = 0;
+  _started = millis();
+  RetentionTest::begin(0x4000, _banks, RETENTION_DEFAULT_STEP_MS);
+  return true;
+}
+
+bool DRAMRetentionConsole::stepTest() {
+  if (!RetentionTest::isDone()) {
+    RetentionTest::step();
+    if (RetentionTest::getRound() != _round) {
+      _round = RetentionTest::getRound();
+      setProgressValue(5 + (uint16_t)_round * 90 / RETENTION_ROUNDS);
+      print(F("."));
+    }
+    return true;
+  }
+
+  uint32_t elapsed = millis() - _started;
+  println();
+  setProgressValue(100);
+  MemoryBus.endSession();
+  Model1.deactivateTestSignal();
+  printResults(elapsed);
+  return false;
+}
+
+void DRAMRetentionConsole::cancelTest() {
+  // Refresh back on before the bus session ends
+  RetentionTest::cancel();
+}
+
+void DRAMRetentionConsole::printResults(uint32_t elapsed) {
+  const uint16_t stepMs = RETENTION_DEFAULT_STEP_MS;
+
+  // Histogram over all rows; steps 0 means the row failed the shortest hold
+  static const uint8_t limits[] = {1, WEAK_ROW_STEPS, 16, 64, RETENTION_MAX_STEPS};
+  uint16_t buckets[sizeof(limits) + 1] = {};
+  uint8_t minimum = RETENTION_MAX_STEPS;
+  uint8_t minimumBank = 0;
+  uint8_t minimumRow = 0;
+  uint16_t weakRows = 0;
+  for (uint8_t bank = 0; bank < _banks; bank++) {
+    for (uint8_t row = 0; row < DRAM_ROWS; row++) {
+      uint8_t steps = RetentionTest::getSteps(bank, row);
+      uint8_t bucket = 0;
+      while (bucket < sizeof(limits) && steps >= limits[bucket]) {
+        bucket++;
+      }
+      buckets[bucket]++;
+      if (steps < WEAK_ROW_STEPS) {
+        weakRows++;
+      }
+      if (steps < minimum) {
+        minimum = steps;
+        minimumBank = bank;
+        minimumRow = row;
+      }
+    }
+  }
+
+  cls();
+  println(F("--- Retention ---"));
+  print(F("Weakest: bank "));
+  print(minimumBank);
+  print(F(" row "));
+  print(minimumRow);
+  print(F(" "));
+  printHold(minimum);
+  println();
+
+  for (uint8_t bucket = 0; bucket <= sizeof(limits); bucket++) {
+    setTextColor(0xFFFF, 0x0000);  // White
+    if (bucket == 0) {
+      print(F("<"));
+      print((uint32_t)limits[0] * stepMs);
+    } else if (bucket == sizeof(limits)) {
+      print(F(">="));
+      print((uint32_t)RETENTION_MAX_STEPS * stepMs);
+    } else {
+      print((uint32_t)limits[bucket - 1] * stepMs);
+      print(F("-"));
+      print((uint32_t)limits[bucket] * stepMs);
+    }
+    print(F(" ms: "));
+    bool weak = (bucket == 0 || limits[bucket - 1] < WEAK_ROW_STEPS);
+    if (weak && buckets[bucket] > 0) {
+      setTextColor(0xF800, 0x0000);  // Red
+    } else {
+      setTextColor(0x07E0, 0x0000);  // Green
+    }
+    print(buckets[bucket]);
+    println(F(" rows"));
+  }
+
+  // Shortest hold at which each chip lost a bit
+  for (uint8_t b = 0; b < 8; b++) {
+    setTextColor(0xFFFF, 0x0000);  // White
+    print(F("Bit "));
+    print(b);
+    print(F(" ("));
+    print(DRAM_IC_REFS[b]);
+    print(F("): "));
+    uint8_t steps = RetentionTest::getBitSteps(b);
+    if (steps == RETENTION_MAX_STEPS) {
+      setTextColor(0x07E0, 0x0000);  // Green
+      println(F("holds"));
+    } else {
+      setTextColor((steps < WEAK_ROW_STEPS) ? 0xF800 : 0xFFE0, 0x0000);  // Red / Yellow
+      print(F("fails at "));
+      print((uint32_t)steps * stepMs);
+      println(F(" ms"));
+    }
+  }
+
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("Time: "));
+  print(elapsed / 1000);
+  println(F(" s"));
+
+  M1Shield.setLEDColor((weakRows == 0) ? COLOR_GREEN : COLOR_RED);
+}
+
+void DRAMRetentionConsole::printHold(uint8_t steps) {
+  uint16_t stepMs = RETENTION_DEFAULT_STEP_MS;
+  if (steps == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    print(F("<"));
+    print(stepMs);
+  } else if (steps == RETENTION_MAX_STEPS) {
+    setTextColor(0x07E0, 0x0000);  // Green
+    print(F(">="));
+    print((uint32_t)steps * stepMs);
+  } else {
+    setTextColor((steps < WEAK_ROW_STEPS) ? 0xF800 : 0x07E0, 0x0000);  // Red / Green
+    print((uint32_t)steps * stepMs);
+  }
+  print(F(" ms"));
+  setTextColor(0xFFFF, 0x0000);  // White
+}
+
+Screen *DRAMRetentionConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+
+  return nullptr;
+}
@@ -0,0 +1,35 @@
+#ifndef DRAM_RETENTION_CONSOLE_H
+#define DRAM_RETENTION_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMRetentionConsole - Per-row DRAM retention time with refresh disabled
+ *
+ * Turns off the harness memory refresh and binary-searches, for every row of
+ * each 4116 bank, the longest hold time the row survives (see RetentionTest).
+ * Shows the weakest rows, a histogram of all rows and the shortest failing
+ * hold per chip. The search runs in small steps from loop(); refresh is
+ * restored before the results are shown, or at once when MENU cancels it.
+ */
+class DRAMRetentionConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMRetentionConsole();
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+  bool beginTest() override;
+  bool stepTest() override;
+  void cancelTest() override;
+
+ private:
+  uint8_t _banks;
+  uint8_t _round;      // Round whose dot is shown
+  uint32_t _started;   // millis() the search started
+
+  void printResults(uint32_t elapsed);
+  void printHold(uint8_t steps);
+};
+
+#endif  // DRAM_RETENTION_CONSOLE_H
@@ -0,0 +1,149 @@
+#include "./DRAMRowHammerConsole.h"
+
+#include <Arduino.h>
+#include <M1Shield.h>
+
+#include "../../globals.h"
+#include "../../memory/RowHammerTest.h"
+#include "./DRAMMenu.h"
+
+// Selectable activations per aggressor and aggressor patterns
+static const uint32_t HAMMER_COUNTS[] PROGMEM = {5000, 10000, ROW_HAMMER_DEFAULT_COUNT, 50000,
+                                                 100000, 200000};
+static const uint8_t HAMMER_COUNT_CHOICES = sizeof(HAMMER_COUNTS) / sizeof(HAMMER_COUNTS[0]);
+static const uint8_t HAMMER_PATTERNS[] PROGMEM = {ROW_HAMMER_DEFAULT_PATTERN, 0x00, 0x55, 0xAA};
+static const uint8_t HAMMER_PATTERN_CHOICES = sizeof(HAMMER_PATTERNS);
+
+DRAMRowHammerConsole::DRAMRowHammerConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM Row Hammer"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  _banks = 0;
+  _countIndex = 2;  // ROW_HAMMER_DEFAULT_COUNT
+  _patternIndex = 0;
+  _ready = false;
+  _startRequested = false;
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("U/D:Count"), F("LF:Data"),
+                                          F("RT:Start")};
+  setButtonItemsF(buttons, 4);
+}
+
+void DRAMRowHammerConsole::_executeOnce() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM ROW HAMMER TEST ==="));
+  println();
+
+  // Rows only exist in complete banks of 4116s
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+  _banks = dramSizeKB / 16;
+  if (_banks == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Needs at least 16KB of DRAM"));
+    println(F("(one bank of 4116 chips)"));
+    Globals.logger.errF(F("DRAM row hammer test attempted with %d KB"), dramSizeKB);
+    return;
+  }
+
+  _ready = true;
+  printIntro();
+}
+
+void DRAMRowHammerConsole::printIntro() {
+  uint32_t count = pgm_read_dword(&HAMMER_COUNTS[_countIndex]);
+  uint8_t pattern = pgm_read_byte(&HAMMER_PATTERNS[_patternIndex]);
+
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM ROW HAMMER TEST ==="));
+  println();
+  print(F("Testing "));
+  print(_banks * DRAM_ROWS);
+  println(F(" victim rows"));
+  println(F("Both neighbour rows hammered"));
+  println(F("IC References: Z17,Z16,Z18,Z19,Z15,Z20,Z14,Z13"));
+  println();
+
+  print(F("Activations per aggressor: "));
+  println(count);
+  print(F("Aggressor 0x"));
+  print(pattern, HEX);
+  print(F(", victim 0x"));
+  println((uint8_t)~pattern, HEX);
+  print(F("Total activations: "));
+  println(RowHammerTest::getActivations(_banks, count));
+  println();
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("UP/DOWN: count, LEFT: data"));
+  println(F("RIGHT: start"));
+  setTextColor(0xFFFF, 0x0000);  // White
+}
+
+void DRAMRowHammerConsole::loop() {
+  RAMTestSuiteConsole::loop();
+
+  if (_startRequested) {
+    _startRequested = false;
+    runHammer();
+  }
+}
+
+void DRAMRowHammerConsole::runHammer() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+
+  const uint16_t start = 0x4000;  // DRAM start address
+  uint32_t count = pgm_read_dword(&HAMMER_COUNTS[_countIndex]);
+  uint8_t pattern = pgm_read_byte(&HAMMER_PATTERNS[_patternIndex]);
+
+  if (!beginTestRun(start)) {
+    return;
+  }
+
+  setProgressValue(5);
+  M1Shield.setLEDColor(COLOR_CYAN);
+  setTextColor(0x07FF, 0x0000);  // Cyan
+  print(F("Hammering"));
+  setTextColor(0xFFFF, 0x0000);  // White
+
+  RowHammerResult hammer;
+  RowHammerTest::run(start, _banks, count, pattern, hammer, this);
+
+  printSummary(hammer.result, DRAM_IC_REFS);
+  print(F("Flipped rows: "));
+  print(hammer.flippedRows);
+  print(F(" of "));
+  println(hammer.victimRows);
+  print(F("Activations/s: "));
+  println(RowHammerTest::getActivationsPerSecond(hammer));
+  endTestRun(hammer.result, DRAM_IC_REFS);
+}
+
+Screen *DRAMRowHammerConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+  if (!_ready) {
+    return nullptr;
+  }
+
+  if ((action & BUTTON_UP) && _countIndex + 1 < HAMMER_COUNT_CHOICES) {
+    _countIndex++;
+    printIntro();
+  } else if ((action & BUTTON_DOWN) && _countIndex > 0) {
+    _countIndex--;
+    printIntro();
+  } else if (action & BUTTON_LEFT) {
+    _patternIndex = (_patternIndex + 1) % HAMMER_PATTERN_CHOICES;
+    printIntro();
+  } else if (action & BUTTON_RIGHT) {
+    _ready = false;
+    _startRequested = true;
+  }
+
+  return nullptr;
+}
@@ -0,0 +1,37 @@
+#ifndef DRAM_ROW_HAMMER_CONSOLE_H
+#define DRAM_ROW_HAMMER_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMRowHammerConsole - Row hammer (read-disturb) stress of the DRAM
+ *
+ * Hammers the two neighbours of every DRAM row and checks the row for flipped
+ * bits (see RowHammerTest). Before starting, UP/DOWN select the activations
+ * per aggressor and LEFT the aggressor data pattern; RIGHT starts. Reports
+ * the victim flips per IC and the activation rate the harness achieved.
+ *
+ * Only complete 16KB banks of 4116s are tested.
+ */
+class DRAMRowHammerConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMRowHammerConsole();
+
+  void loop() override;
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+
+ private:
+  uint8_t _banks;
+  uint8_t _countIndex;
+  uint8_t _patternIndex;
+  bool _ready;           // Intro shown, waiting for RIGHT
+  bool _startRequested;  // Run on the next loop()
+
+  void printIntro();
+  void runHammer();
+};
+
+#endif  // DRAM_ROW_HAMMER_CONSOLE_H
@@ -0,0 +1,158 @@
+#include "./DRAMSeedReplayConsole.h"
+
+#include <Arduino.h>
+
+#include "../../globals.h"
+#include "../../memory/DramTopology.h"
+#include "../../memory/RandomPattern.h"
+#include "../../memory/TestSuite.h"
+#include "./DRAMMenu.h"
+
+#define FIELD_PASSES 4
+#define FIELD_STRIDE 5
+#define FIELD_COUNT 6
+
+DRAMSeedReplayConsole::DRAMSeedReplayConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM Seed Replay"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  _length = 0;
+  _seed = RandomPattern::getLastSeed();
+  if (_seed == 0) {
+    _seed = 0x0001;
+  }
+  _passes = RANDOM_PATTERN_DEFAULT_PASSES;
+  _stride = RANDOM_PATTERN_DEFAULT_STRIDE;
+  _field = 0;
+  _ready = false;
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("U/D:Value"), F("LF:Field"),
+                                          F("RT:Start")};
+  setButtonItemsF(buttons, 4);
+}
+
+void DRAMSeedReplayConsole::_executeOnce() {
+  // Get current DRAM size from globals
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+
+  // Validate DRAM size
+  if (dramSizeKB == 0) {
+    cls();
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: DRAM size not configured"));
+    println(F("Please run Hardware Detection first"));
+    Globals.logger.errF(F("DRAM seed replay attempted with zero DRAM size"));
+    return;
+  }
+
+  _length = dramSizeKB * 1024;
+  _ready = true;
+  printIntro();
+}
+
+void DRAMSeedReplayConsole::printIntro() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM SEED REPLAY ==="));
+  println();
+  print(F("Memory Range: 0x4000-0x"));
+  println(0x4000 + _length - 1, HEX);
+  println(F("IC References: Z17,Z16,Z18,Z19,Z15,Z20,Z14,Z13"));
+  println();
+
+  print(F("Seed:   0x"));
+  for (uint8_t digit = 0; digit < 4; digit++) {
+    printField(digit, (_seed >> (12 - digit * 4)) & 0x0F);
+  }
+  println();
+  print(F("Passes: "));
+  printField(FIELD_PASSES, _passes);
+  println();
+  print(F("Stride: 0x"));
+  printField(FIELD_STRIDE, _stride);
+  println();
+  println();
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("LEFT: field, UP/DOWN: value"));
+  println(F("RIGHT: start (RIGHT again stops)"));
+  setTextColor(0xFFFF, 0x0000);  // White
+}
+
+void DRAMSeedReplayConsole::printField(uint8_t field, uint16_t value) {
+  // The selected field is drawn inverted
+  if (field == _field) {
+    setTextColor(0x0000, 0xFFE0);  // Black on yellow
+  }
+  if (field == FIELD_PASSES) {
+    print(value);
+  } else {
+    print(value, HEX);
+  }
+  setTextColor(0xFFFF, 0x0000);  // White
+}
+
+void DRAMSeedReplayConsole::changeField(int8_t delta) {
+  if (_field < FIELD_PASSES) {
+    // Each seed digit wraps on its own
+    uint8_t shift = 12 - _field * 4;
+    uint8_t digit = (((_seed >> shift) & 0x0F) + delta) & 0x0F;
+    _seed = (_seed & ~(0x0F << shift)) | ((uint16_t)digit << shift);
+  } else if (_field == FIELD_PASSES) {
+    _passes += delta;
+    if (_passes == 0) {
+      _passes = SEED_REPLAY_MAX_PASSES;
+    } else if (_passes > SEED_REPLAY_MAX_PASSES) {
+      _passes = 1;
+    }
+  } else {
+    _stride += delta;
+  }
+}
+
+void DRAMSeedReplayConsole::startReplay() {
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("LF:Pause"), F("RT:Stop")};
+  setButtonItemsF(buttons, 3);
+
+  // Seed 0 would draw fresh seeds; RandomPattern never uses it either
+  uint16_t seed = RandomPattern::getSeed(_seed, 0, _stride);
+  uint32_t testMask = getSuiteFlagMask(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, SUITE_RANDOM_PATTERN);
+  Globals.logger.infoF(F("DRAM seed replay: seed 0x%04X, %d passes, stride 0x%X"), seed, _passes,
+                       _stride);
+
+  cls();
+  runSoakTest(0x4000, _length, DRAM_IC_REFS, testMask, _passes, 0);
+  setReplaySeed(seed, _stride);
+}
+
+Screen *DRAMSeedReplayConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+
+  if (!_ready) {
+    if (action & BUTTON_RIGHT) {
+      stopSoak();
+      return nullptr;
+    }
+    return RAMTestSuiteConsole::actionTaken(action, offsetX, offsetY);
+  }
+
+  if (action & BUTTON_UP) {
+    changeField(1);
+    printIntro();
+  } else if (action & BUTTON_DOWN) {
+    changeField(-1);
+    printIntro();
+  } else if (action & BUTTON_LEFT) {
+    _field = (_field + 1) % FIELD_COUNT;
+    printIntro();
+  } else if (action & BUTTON_RIGHT) {
+    _ready = false;
+    startReplay();
+  }
+
+  return nullptr;
+}
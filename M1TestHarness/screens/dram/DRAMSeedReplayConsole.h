@@ -0,0 +1,43 @@
+#ifndef DRAM_SEED_REPLAY_CONSOLE_H
+#define DRAM_SEED_REPLAY_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+#define SEED_REPLAY_MAX_PASSES 100
+
+/**
+ * DRAMSeedReplayConsole - Replays the random pattern test with a given seed
+ *
+ * Every pass of the random pattern test prints its seed, and the same seed
+ * writes the same bytes again, so a failure seen once can be reproduced. This
+ * screen runs the suite's random pattern tests pass after pass with seed,
+ * seed + stride, seed + 2 * stride, ... (see RandomPattern); a stride of 0
+ * repeats the one seed. The seed starts as the last one drawn since power-on.
+ *
+ * Before starting, LEFT selects a field (the four seed digits, passes,
+ * stride) and UP/DOWN change it. RIGHT starts, RIGHT again stops.
+ */
+class DRAMSeedReplayConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMSeedReplayConsole();
+
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+
+ private:
+  uint16_t _length;
+  uint16_t _seed;
+  uint16_t _passes;
+  uint16_t _stride;
+  uint8_t _field;  // 0-3 = seed digit (most significant first), 4 = passes, 5 = stride
+  bool _ready;     // Intro shown, waiting for RIGHT
+
+  void printIntro();
+  void printField(uint8_t field, uint16_t value);
+  void changeField(int8_t delta);
+  void startReplay();
+};
+
+#endif  // DRAM_SEED_REPLAY_CONSOLE_H
@@ -0,0 +1,130 @@
+#include "./DRAMSoakConsole.h"
+
+#include <Arduino.h>
+
+#include "../../globals.h"
+#include "../../memory/DramTopology.h"
+#include "../../memory/TestSuite.h"
+#include "./DRAMMenu.h"
+
+// Soak limits: passes, or hours when passes is 0
+struct SoakLimit {
+  uint16_t passes;
+  uint8_t hours;
+};
+
+static const SoakLimit SOAK_LIMITS[] PROGMEM = {{10, 0}, {100, 0}, {0, 1}, {0, 8}, {0, 24}};
+static const uint8_t SOAK_LIMIT_CHOICES = sizeof(SOAK_LIMITS) / sizeof(SOAK_LIMITS[0]);
+
+DRAMSoakConsole::DRAMSoakConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM Soak"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  _length = 0;
+  _testChoice = 0;
+  _limitChoice = 2;  // 1 hour
+  _ready = false;
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("U/D:Tests"), F("LF:Limit"),
+                                          F("RT:Start")};
+  setButtonItemsF(buttons, 4);
+}
+
+void DRAMSoakConsole::_executeOnce() {
+  // Get current DRAM size from globals
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+
+  // Validate DRAM size
+  if (dramSizeKB == 0) {
+    cls();
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: DRAM size not configured"));
+    println(F("Please run Hardware Detection first"));
+    Globals.logger.errF(F("DRAM soak attempted with zero DRAM size"));
+    return;
+  }
+
+  _length = dramSizeKB * 1024;
+  _ready = true;
+  printIntro();
+}
+
+void DRAMSoakConsole::printIntro() {
+  SoakLimit limit;
+  memcpy_P(&limit, &SOAK_LIMITS[_limitChoice], sizeof(limit));
+
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM SOAK TEST ==="));
+  println();
+  print(F("Memory Range: 0x4000-0x"));
+  println(0x4000 + _length - 1, HEX);
+  println(F("IC References: Z17,Z16,Z18,Z19,Z15,Z20,Z14,Z13"));
+  println();
+
+  print(F("Tests: "));
+  if (_testChoice == 0) {
+    println(F("whole suite"));
+  } else {
+    println(getSuiteTitle(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, _testChoice - 1));
+  }
+  print(F("Stop after: "));
+  if (limit.passes) {
+    print(limit.passes);
+    println(F(" passes"));
+  } else {
+    print(limit.hours);
+    println(F(" h"));
+  }
+  println();
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("UP/DOWN: tests, LEFT: limit"));
+  println(F("RIGHT: start (RIGHT again stops)"));
+  setTextColor(0xFFFF, 0x0000);  // White
+}
+
+void DRAMSoakConsole::startSoak() {
+  SoakLimit limit;
+  memcpy_P(&limit, &SOAK_LIMITS[_limitChoice], sizeof(limit));
+  uint32_t testMask = (_testChoice == 0) ? SUITE_ALL_TESTS : (1UL << (_testChoice - 1));
+
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("LF:Pause"), F("RT:Stop")};
+  setButtonItemsF(buttons, 3);
+
+  cls();
+  runSoakTest(0x4000, _length, DRAM_IC_REFS, testMask, limit.passes, limit.hours * 3600000UL);
+}
+
+Screen *DRAMSoakConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+
+  if (!_ready) {
+    if (action & BUTTON_RIGHT) {
+      stopSoak();
+      return nullptr;
+    }
+    return RAMTestSuiteConsole::actionTaken(action, offsetX, offsetY);
+  }
+
+  uint8_t tests = getSuiteTitledCount(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT);
+  if (action & BUTTON_UP) {
+    _testChoice = (_testChoice + 1) % (tests + 1);
+    printIntro();
+  } else if (action & BUTTON_DOWN) {
+    _testChoice = (_testChoice + tests) % (tests + 1);
+    printIntro();
+  } else if (action & BUTTON_LEFT) {
+    _limitChoice = (_limitChoice + 1) % SOAK_LIMIT_CHOICES;
+    printIntro();
+  } else if (action & BUTTON_RIGHT) {
+    _ready = false;
+    startSoak();
+  }
+
+  return nullptr;
+}
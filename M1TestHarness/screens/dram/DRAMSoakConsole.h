@@ -0,0 +1,36 @@
+#ifndef DRAM_SOAK_CONSOLE_H
+#define DRAM_SOAK_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMSoakConsole - DRAM suite looped for hours to catch intermittent faults
+ *
+ * Runs the whole suite or a single test of it pass after pass, without
+ * blocking the UI, until a pass count or time limit is reached or RIGHT stops
+ * it. Every pass prints one line; the report gives each IC's errors, failing
+ * passes, errors per hour and whether it failed solid or intermittently (see
+ * SoakStats).
+ *
+ * Before starting, UP/DOWN select the tests and LEFT the limit.
+ */
+class DRAMSoakConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMSoakConsole();
+
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+
+ private:
+  uint16_t _length;
+  uint8_t _testChoice;   // 0 = all tests, n = titled test n - 1
+  uint8_t _limitChoice;
+  bool _ready;           // Intro shown, waiting for RIGHT
+
+  void printIntro();
+  void startSoak();
+};
+
+#endif  // DRAM_SOAK_CONSOLE_H
@@ -0,0 +1,122 @@
+#include "./DRAMSuiteComposerMenu.h"
+
+#include <Arduino.h>
+
+#include "../../globals.h"
+#include "./DRAMCustomSuiteConsole.h"
+#include "./DRAMMenu.h"
+
+// Items after the tests
+#define COMPOSER_ITEM_START 0
+#define COMPOSER_ITEM_LENGTH 1
+#define COMPOSER_ITEM_NPSF 2
+#define COMPOSER_ITEM_RUN 3
+#define COMPOSER_ITEM_COUNT 4
+
+char DRAMSuiteComposerMenu::_configBuffer[8];
+
+DRAMSuiteComposerMenu::DRAMSuiteComposerMenu() : MenuScreen() {
+  setTitleF(F("Custom DRAM Suite"));
+
+  _composition.load();
+  _tests = getSuiteTitledCount(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT);
+  if (_tests > SUITE_COMPOSITION_MAX_TESTS) {
+    _tests = SUITE_COMPOSITION_MAX_TESTS;
+  }
+
+  // Test titles straight from the suite, then the range and run items
+  const __FlashStringHelper *menuItems[SUITE_COMPOSITION_MAX_TESTS + COMPOSER_ITEM_COUNT];
+  for (uint8_t n = 0; n < _tests; n++) {
+    menuItems[n] = getSuiteTitle(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, n);
+  }
+  menuItems[_tests + COMPOSER_ITEM_START] = F("Start");
+  menuItems[_tests + COMPOSER_ITEM_LENGTH] = F("Length");
+  menuItems[_tests + COMPOSER_ITEM_NPSF] = F("NPSF Test");
+  menuItems[_tests + COMPOSER_ITEM_RUN] = F("Run Custom Suite");
+  setMenuItemsF(menuItems, _tests + COMPOSER_ITEM_COUNT);
+}
+
+Screen *DRAMSuiteComposerMenu::_getSelectedMenuItemScreen(int index) {
+  if (index == -1) {
+    _composition.save();
+    return new DRAMMenu();
+  }
+  if (index < 0) {
+    return nullptr;
+  }
+
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+  if (index < _tests) {
+    // Off, x1 .. x4, Off
+    uint8_t runs = _composition.getRuns(index) + 1;
+    _composition.setRuns(index, (runs > SUITE_COMPOSITION_MAX_REPEATS) ? 0 : runs);
+    refreshMenu();
+    return nullptr;
+  }
+
+  switch (index - _tests) {
+    case COMPOSER_ITEM_START:  // Next bank, back to the first past the end
+      _composition.startKB += SUITE_COMPOSITION_START_STEP_KB;
+      if (_composition.startKB >= dramSizeKB) {
+        _composition.startKB = 0;
+      }
+      refreshMenu();
+      return nullptr;
+
+    case COMPOSER_ITEM_LENGTH: {  // 4KB steps up to what is left, then all
+      uint16_t available = (dramSizeKB > _composition.startKB) ? dramSizeKB - _composition.startKB : 0;
+      _composition.lengthKB += SUITE_COMPOSITION_LENGTH_STEP_KB;
+      if (_composition.lengthKB >= available) {
+        _composition.lengthKB = 0;
+      }
+      refreshMenu();
+      return nullptr;
+    }
+
+    case COMPOSER_ITEM_NPSF:
+      _composition.npsf = !_composition.npsf;
+      refreshMenu();
+      return nullptr;
+
+    case COMPOSER_ITEM_RUN:
+      _composition.save();
+      return new DRAMCustomSuiteConsole();
+  }
+  return nullptr;
+}
+
+const char *DRAMSuiteComposerMenu::_getMenuItemConfigValue(uint8_t index) {
+  if (index < _tests) {
+    uint8_t runs = _composition.getRuns(index);
+    if (runs == 0) {
+      return "Off";
+    }
+    snprintf(_configBuffer, sizeof(_configBuffer), "x%u", runs);
+    return _configBuffer;
+  }
+
+  switch (index - _tests) {
+    case COMPOSER_ITEM_START:
+      snprintf(_configBuffer, sizeof(_configBuffer), "0x%04X", _composition.getStart(0x4000));
+      return _configBuffer;
+
+    case COMPOSER_ITEM_LENGTH:
+      if (_composition.lengthKB == 0) {
+        return "All";
+      }
+      snprintf(_configBuffer, sizeof(_configBuffer), "%uKB", _composition.lengthKB);
+      return _configBuffer;
+
+    case COMPOSER_ITEM_NPSF:
+      return _composition.npsf ? "On" : "Off";
+  }
+  return nullptr;
+}
+
+bool DRAMSuiteComposerMenu::_isMenuItemEnabled(uint8_t index) const {
+  // Nothing to run without a selected test
+  if (index == _tests + COMPOSER_ITEM_RUN) {
+    return _composition.getPassCount() > 0;
+  }
+  return true;
+}
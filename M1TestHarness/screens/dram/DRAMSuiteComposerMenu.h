@@ -0,0 +1,31 @@
+#ifndef DRAM_SUITE_COMPOSER_MENU_H
+#define DRAM_SUITE_COMPOSER_MENU_H
+
+#include <MenuScreen.h>
+
+#include "../../memory/SuiteComposition.h"
+
+/**
+ * DRAMSuiteComposerMenu - Edits the custom DRAM suite
+ *
+ * One item per suite test cycles its runs (Off, x1 to x4); further items
+ * pick the range (start bank, length) and the NPSF test. The composition is
+ * saved to EEPROM when the menu is left or the suite is started.
+ */
+class DRAMSuiteComposerMenu : public MenuScreen {
+ public:
+  DRAMSuiteComposerMenu();
+
+ protected:
+  Screen *_getSelectedMenuItemScreen(int index) override;
+  const char *_getMenuItemConfigValue(uint8_t index) override;
+  bool _isMenuItemEnabled(uint8_t index) const override;
+
+ private:
+  SuiteComposition _composition;
+  uint8_t _tests;  // Titled suite tests, the first menu items
+
+  static char _configBuffer[8];
+};
+
+#endif  // DRAM_SUITE_COMPOSER_MENU_H
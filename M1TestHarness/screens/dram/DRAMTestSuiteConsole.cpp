@@ -3,16 +3,18 @@
 #include <Arduino.h>
 
 #include "../../globals.h"
+#include "../../memory/DramTopology.h"
 #include "./DRAMMenu.h"
 
-DRAMTestSuiteConsole::DRAMTestSuiteConsole() : RAMTestSuiteConsole() {
-  setTitleF(F("DRAM Tests"));
+DRAMTestSuiteConsole::DRAMTestSuiteConsole(bool screening) : RAMTestSuiteConsole() {
+  _screening = screening;
+  setTitleF(screening ? F("DRAM Screen") : F("DRAM Tests"));
   setConsoleBackground(0x0000);
   setTextColor(0xFFFF, 0x0000);
 
   // Set button labels
-  const __FlashStringHelper *buttons[] = {F("M:Menu")};
-  setButtonItemsF(buttons, 1);
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("LF:Pause"), F("RT:+NPSF")};
+  setButtonItemsF(buttons, screening ? 2 : 3);
 }
 
 void DRAMTestSuiteConsole::_executeOnce() {
@@ -43,21 +45,24 @@ void DRAMTestSuiteConsole::_executeOnce() {
   println();
 
   setTextColor(0xF81F, 0x0000);  // Magenta
-  println(F("Starting DRAM comprehensive test..."));
+  if (_screening) {
+    println(F("Starting DRAM quick screen..."));
+  } else {
+    println(F("Starting DRAM comprehensive test..."));
+    println(F("RIGHT adds the NPSF test"));
+  }
   println();
 
-  delay(5000);
-
-  cls();
-  setTextColor(0xFFFF, 0x0000);  // White
-
   // Local DRAM constants - use selected DRAM size
   const uint16_t start = 0x4000;              // DRAM start address
   const uint16_t length = dramSizeKB * 1024;  // Selected DRAM size in bytes
-  const char *const icRefs[] PROGMEM = {"Z17", "Z16", "Z18", "Z19", "Z15", "Z20", "Z14", "Z13"};
 
   // Run the comprehensive test suite on DRAM
-  runSpecializedTest(start, length, icRefs);
+  if (_screening) {
+    runScreenedTest(start, length, DRAM_IC_REFS);
+  } else {
+    runSpecializedTest(start, length, DRAM_IC_REFS);
+  }
 }
 
 Screen *DRAMTestSuiteConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
@@ -65,5 +70,5 @@ Screen *DRAMTestSuiteConsole::actionTaken(ActionTaken action, int8_t offsetX, in
     return new DRAMMenu();
   }
 
-  return nullptr;
+  return RAMTestSuiteConsole::actionTaken(action, offsetX, offsetY);
 }
@@ -19,14 +19,18 @@
  * - Progress tracking during tests
  * - Per-bit error analysis mapped to specific ICs
  * - Automatic TEST signal control
+ * - Optional quick screen that runs the full suite only on the failing region
  */
 class DRAMTestSuiteConsole : public RAMTestSuiteConsole {
  public:
-  DRAMTestSuiteConsole();
+  DRAMTestSuiteConsole(bool screening = false);
   Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
 
  protected:
   void _executeOnce() override;
+
+ private:
+  bool _screening;
 };
 
 #endif  // DRAM_TEST_SUITE_CONSOLE_H
@@ -0,0 +1,155 @@
+#include "./DRAMTimingConsole.h"
+
+#include <Arduino.h>
+#include <M1Shield.h>
+#include <Model1.h>
+
+#include "../../globals.h"
+#include "../../memory/MemoryBus.h"
+#include "../../memory/TimingMargin.h"
+#include "./DRAMMenu.h"
+
+DRAMTimingConsole::DRAMTimingConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM Timing"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu")};
+  setButtonItemsF(buttons, 1);
+}
+
+void DRAMTimingConsole::_executeOnce() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM TIMING MARGIN ==="));
+  println();
+
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+  uint8_t banks = dramSizeKB / 16;
+  if (banks == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Needs at least 16KB of DRAM"));
+    println(F("(one bank of 4116 chips)"));
+    Globals.logger.errF(F("DRAM timing test attempted with %d KB"), dramSizeKB);
+    return;
+  }
+
+  println(F("Generated RAS/MUX/CAS cycles on the"));
+  print(F("diagonal of "));
+  print(banks);
+  println(F(" bank(s)"));
+  print(F("Delays from "));
+  print(TIMING_CYCLES_TO_NS(TimingMargin::getStepCycles(0)));
+  println(F(" ns down to 0 added"));
+  println();
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("Starting DRAM timing test..."));
+  println();
+
+  _banks = banks;
+  runSteppedTest(0x4000, DRAM_IC_REFS);  // DRAM start address
+}
+
+bool DRAMTimingConsole::beginTest() {
+  setProgressValue(5);
+  M1Shield.setLEDColor(COLOR_CYAN);
+  setTextColor(0x07FF, 0x0000);  // Cyan
+  print(F("Shortening delays"));
+  setTextColor(0xFFFF, 0x0000);  // White
+
+  _result = {};
+  _parameter = 0;
+  _started = millis();
+  TimingMargin::begin(0x4000, _banks);
+  return true;
+}
+
+bool DRAMTimingConsole::stepTest() {
+  if (!TimingMargin::isDone()) {
+    TimingMargin::step(_result);
+    if (TimingMargin::getParameter() != _parameter) {
+      _parameter = TimingMargin::getParameter();
+      setProgressValue(5 + (uint16_t)_parameter * 90 / TIMING_PARAMETERS);
+      print(F("."));
+    }
+    return true;
+  }
+
+  uint32_t elapsed = millis() - _started;
+  println();
+  printSummary(_result, DRAM_IC_REFS);
+  printResults(elapsed);
+  return false;
+}
+
+void DRAMTimingConsole::printResults(uint32_t elapsed) {
+  // Shortest delays per chip, read and write; the longest means no margin
+  print(F("Added ns: "));
+  for (uint8_t parameter = 0; parameter < TIMING_PARAMETERS; parameter++) {
+    if (parameter > 0) {
+      print(F(","));
+    }
+    print(TimingMargin::getParameterName(parameter));
+  }
+  println();
+
+  uint8_t marginal = 0;
+  for (uint8_t b = 0; b < 8; b++) {
+    bool weak = false;
+    for (uint8_t parameter = 0; parameter < TIMING_PARAMETERS; parameter++) {
+      for (uint8_t write = 0; write < 2; write++) {
+        uint8_t cycles = TimingMargin::getMinCycles(parameter, write, b);
+        if (cycles == TIMING_FAILED || cycles == TimingMargin::getStepCycles(0)) {
+          weak = true;
+        }
+      }
+    }
+    if (weak) {
+      marginal++;
+    }
+
+    setTextColor(weak ? 0xFFE0 : 0x07E0, 0x0000);  // Yellow / Green
+    print(DRAM_IC_REFS[b]);
+    print(F(" R:"));
+    printMargins(false, b);
+    print(F(" W:"));
+    printMargins(true, b);
+    println();
+  }
+
+  setTextColor(0xFFFF, 0x0000);  // White
+  print(F("Marginal chips: "));
+  println(marginal);
+  print(F("Time: "));
+  print(elapsed / 1000);
+  println(F(" s"));
+
+  endTestRun(_result, DRAM_IC_REFS);
+  if (_result.totalErrors == 0 && marginal > 0) {
+    M1Shield.setLEDColor(COLOR_YELLOW);
+  }
+}
+
+void DRAMTimingConsole::printMargins(bool write, uint8_t bit) {
+  for (uint8_t parameter = 0; parameter < TIMING_PARAMETERS; parameter++) {
+    if (parameter > 0) {
+      print(F(","));
+    }
+    uint8_t cycles = TimingMargin::getMinCycles(parameter, write, bit);
+    if (cycles == TIMING_FAILED) {
+      print(F("X"));
+    } else {
+      print(TIMING_CYCLES_TO_NS(cycles));
+    }
+  }
+}
+
+Screen *DRAMTimingConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+
+  return nullptr;
+}
@@ -0,0 +1,35 @@
+#ifndef DRAM_TIMING_CONSOLE_H
+#define DRAM_TIMING_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMTimingConsole - Read and write timing margin of every DRAM chip
+ *
+ * Generates the RAS/MUX/CAS cycles itself and shortens each delay until the
+ * chips fail (see TimingMargin). Shows, per chip, the shortest added delays
+ * it still reads and writes with; chips that need the longest delay on any
+ * edge are flagged as marginal. The sweep runs one delay step per loop(),
+ * so MENU stops it.
+ */
+class DRAMTimingConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMTimingConsole();
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+  bool beginTest() override;
+  bool stepTest() override;
+
+ private:
+  TestResult _result;
+  uint8_t _banks;
+  uint8_t _parameter;  // Parameter whose dot is shown
+  uint32_t _started;   // millis() the sweep started
+
+  void printResults(uint32_t elapsed);
+  void printMargins(bool write, uint8_t bit);
+};
+
+#endif  // DRAM_TIMING_CONSOLE_H
@@ -0,0 +1,99 @@
+#include "./DRAMTopologyConsole.h"
+
+#include <Arduino.h>
+#include <M1Shield.h>
+
+#include "../../globals.h"
+#include "../../memory/DramTopology.h"
+#include "./DRAMMenu.h"
+
+DRAMTopologyConsole::DRAMTopologyConsole() : RAMTestSuiteConsole() {
+  setTitleF(F("DRAM Topology"));
+  setConsoleBackground(0x0000);
+  setTextColor(0xFFFF, 0x0000);
+
+  // Set button labels
+  const __FlashStringHelper *buttons[] = {F("M:Menu")};
+  setButtonItemsF(buttons, 1);
+}
+
+void DRAMTopologyConsole::_executeOnce() {
+  cls();
+  setTextColor(0xFFFF, 0x0000);  // White
+  println(F("=== DRAM TOPOLOGY TEST ==="));
+  println();
+
+  // Only complete banks of 4116s have the full 128 x 128 matrix
+  uint16_t dramSizeKB = Globals.getDRAMSizeKB();
+  uint8_t banks = dramSizeKB / 16;
+  if (banks == 0) {
+    setTextColor(0xF800, 0x0000);  // Red
+    println(F("ERROR: Needs at least 16KB of DRAM"));
+    println(F("(one bank of 4116 chips)"));
+    Globals.logger.errF(F("DRAM topology test attempted with %d KB"), dramSizeKB);
+    return;
+  }
+
+  setTextColor(0xFFFF, 0x0000);
+  print(F("Testing "));
+  print(banks);
+  println(F(" bank(s) of 128 x 128 cells"));
+  println(F("Row = A0-A6 (RAS), Column = A7-A13 (CAS)"));
+  println(F("IC References: Z17,Z16,Z18,Z19,Z15,Z20,Z14,Z13"));
+  println();
+
+  setTextColor(0xF81F, 0x0000);  // Magenta
+  println(F("Starting DRAM topology test..."));
+  println();
+
+  _banks = banks;
+  runSteppedTest(0x4000, DRAM_IC_REFS);  // DRAM start address
+}
+
+bool DRAMTopologyConsole::beginTest() {
+  _result = {};
+  _test = 0xFF;
+  _element = 0xFF;
+  DramTopology::begin(0x4000, _banks);
+  return true;
+}
+
+bool DRAMTopologyConsole::stepTest() {
+  if (DramTopology::isDone()) {
+    println();
+    printSummary(_result, DRAM_IC_REFS);
+    endTestRun(_result, DRAM_IC_REFS);
+    return false;
+  }
+
+  uint8_t t = DramTopology::getTest();
+  if (t != _test) {
+    if (_test != 0xFF) {
+      println();
+    }
+    _test = t;
+    _element = 0xFF;
+    setProgressValue(5 + (uint16_t)t * 90 / DRAM_TOPOLOGY_TEST_COUNT);
+    M1Shield.setLEDColor((t & 1) ? COLOR_MAGENTA : COLOR_CYAN);
+
+    setTextColor(0x07FF, 0x0000);  // Cyan
+    print(DramTopology::getTitle(t));
+    setTextColor(0xFFFF, 0x0000);  // White
+  }
+  if (DramTopology::getElement() != _element) {
+    _element = DramTopology::getElement();
+    print(F("."));
+  }
+
+  // About SUITE_RUN_SLICE_CELLS cells per call
+  DramTopology::step(_result, SUITE_RUN_SLICE_CELLS / DRAM_ROWS);
+  return true;
+}
+
+Screen *DRAMTopologyConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
+  if (action & BUTTON_MENU) {
+    return new DRAMMenu();
+  }
+
+  return nullptr;
+}
@@ -0,0 +1,39 @@
+#ifndef DRAM_TOPOLOGY_CONSOLE_H
+#define DRAM_TOPOLOGY_CONSOLE_H
+
+#include "../RAMTestSuiteConsole.h"
+
+/**
+ * DRAMTopologyConsole - DRAM tests along the physical 4116 row/column matrix
+ *
+ * Instead of sweeping DRAM linearly, the tests walk the 128 x 128 cell matrix
+ * of each bank of 4116s the way the Model I multiplexes the address (RAS =
+ * A0-A6, CAS = A7-A13). This targets word-line, row-decoder, bit-line and
+ * sense-amp faults directly.
+ *
+ * Tests:
+ * - Diagonal screen: March B on one cell per row and column (128 cells/bank)
+ * - Row-major and column-major March C-
+ * - Row and column stripes: March C- with adjacent lines inverted
+ *
+ * Only complete 16KB banks of 4116s are tested. The tests run a few lines per
+ * loop() after the intro, so MENU stops them.
+ */
+class DRAMTopologyConsole : public RAMTestSuiteConsole {
+ public:
+  DRAMTopologyConsole();
+  Screen *actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) override;
+
+ protected:
+  void _executeOnce() override;
+  bool beginTest() override;
+  bool stepTest() override;
+
+ private:
+  TestResult _result;
+  uint8_t _banks;
+  uint8_t _test;     // Test whose title is shown
+  uint8_t _element;  // Element of _test last stepped
+};
+
+#endif  // DRAM_TOPOLOGY_CONSOLE_H
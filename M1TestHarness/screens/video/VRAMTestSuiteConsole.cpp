@@ -5,14 +5,16 @@
 #include "../../globals.h"
 #include "./VideoMenu.h"
 
+const char *const VRAM_IC_REFS[8] = {"Z48", "Z47", "Z46", "Z45", "Z61", "Z62", "Z?", "Z63"};
+
 VRAMTestSuiteConsole::VRAMTestSuiteConsole() : RAMTestSuiteConsole() {
   setTitleF(F("VRAM Tests"));
   setConsoleBackground(0x0000);
   setTextColor(0xFFFF, 0x0000);
 
   // Set button labels
-  const __FlashStringHelper *buttons[] = {F("M:Menu")};
-  setButtonItemsF(buttons, 1);
+  const __FlashStringHelper *buttons[] = {F("M:Menu"), F("LF:Pause"), F("RT:+NPSF")};
+  setButtonItemsF(buttons, 3);
 
 }
 
@@ -34,20 +36,15 @@ void VRAMTestSuiteConsole::_executeOnce() {
 
   setTextColor(0xF81F, 0x0000);  // Magenta
   println(F("Starting VRAM comprehensive test..."));
+  println(F("RIGHT adds the NPSF test"));
   println();
 
-  delay(5000);
-
-  cls();
-  setTextColor(0xFFFF, 0x0000);  // White
-
   // Local VRAM constants - only exist when test is running
   const uint16_t start = 0x3C00;  // VRAM start address
   const uint16_t length = 1024;   // 1KB VRAM
-  const char *const icRefs[] PROGMEM = {"Z48", "Z47", "Z46", "Z45", "Z61", "Z62", "Z?", "Z63"};
 
   // Run the comprehensive test suite on VRAM
-  runSpecializedTest(start, length, icRefs);
+  runSpecializedTest(start, length, VRAM_IC_REFS);
 }
 
 Screen *VRAMTestSuiteConsole::actionTaken(ActionTaken action, int8_t offsetX, int8_t offsetY) {
@@ -55,5 +52,5 @@ Screen *VRAMTestSuiteConsole::actionTaken(ActionTaken action, int8_t offsetX, in
     return new VideoMenu();
   }
 
-  return nullptr;
+  return RAMTestSuiteConsole::actionTaken(action, offsetX, offsetY);
 }
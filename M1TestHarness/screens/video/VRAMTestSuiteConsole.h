@@ -3,6 +3,9 @@
 
 #include "../RAMTestSuiteConsole.h"
 
+// IC of each data bit of the VRAM, bit 0 first (RAM strings, for Print)
+extern const char *const VRAM_IC_REFS[8];
+
 /**
  * VRAMTestSuite - Specialized RAM testing for Video RAM (1KB at 0x3C00-0x3FFF)
  *
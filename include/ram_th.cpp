@@ -1,5 +1,10 @@
 #include "ram_th.h"
 
+#include "../M1TestHarness/memory/MemoryBus.h"
+#include "../M1TestHarness/memory/PatternSearch.h"
+#include "../M1TestHarness/memory/RandomPattern.h"
+#include "../M1TestHarness/memory/TestSuite.h"
+
 namespace RamTH {
 
 // DRAM
@@ -21,6 +26,7 @@ void showMenu() {
   println(TO_LCD, F("g) Game upload (alninvbh)"));
   println(TO_LCD, F("r) Memory -> serial port (HEX)"));
   println(TO_LCD, F("R) Memory -> serial port (ASCII)"));
+  println(TO_LCD, F("s) Search memory for text or bytes"));
   println(TO_LCD, F("t) TESTS ->"));
   println(TO_LCD, F("u) Upload data from serial port [TODO]"));
   println(TO_LCD, F("x) Back to main menu"));
@@ -41,7 +47,7 @@ void showTestsMenu() {
   println(TO_LCD, F(" 6) March LA Algorithm"));
   println(TO_LCD, F(" 7) March SS Algorithm"));
   println(TO_LCD, F(" 8) Moving Inversion (55 Pattern)"));
-  println(TO_LCD, F(" 9) Moving Inversion (Random Pattern)"));
+  println(TO_LCD, F(" 9) Moving Inversion (Random Pattern) [,seed,passes,stride]"));
   println(TO_LCD, F("10) Moving Inversion (Zero Pattern)"));
   println(TO_LCD, F("11) Read Destructive (55 Pattern)"));
   println(TO_LCD, F("12) Read Destructive (AA Pattern)"));
@@ -128,6 +134,11 @@ void runTest(int testNum) {
   print(TO_LCD, F("Length: "), length, Hex);
   println(TO_LCD, F("h"));
 
+  if (!MemoryBus.beginSession()) {
+    println(TO_LCD, F("Error: memory bus not available (TEST signal inactive?)."));
+    return;
+  }
+
   switch (testNum) {
     case 1: {
       printSeparator(TO_LCD, F("[RAM] Address Uniqueness (55 Pattern)"), '-', 52, 0, 5);
@@ -171,7 +182,15 @@ void runTest(int testNum) {
     }
     case 9: {
       printSeparator(TO_LCD, F("[RAM] Moving Inversion (Random Pattern)"), '-', 52, 0, 5);
-      testResult = runMovingInversionTest(start, length, random(0, 255));
+
+      // Optional seed (replay), pass count and seed stride after the length
+      uint16_t seed = (nTok > 2 && tokens[2][0] != '\0') ? strToUint16(tokens[2]) : 0;
+      uint16_t passes = (nTok > 3 && tokens[3][0] != '\0') ? strToUint16(tokens[3])
+                                                             : RANDOM_PATTERN_DEFAULT_PASSES;
+      uint16_t stride = (nTok > 4 && tokens[4][0] != '\0') ? strToUint16(tokens[4])
+                                                             : RANDOM_PATTERN_DEFAULT_STRIDE;
+      testResult = runRandomPatternTest(start, length, seed ? seed : RandomPattern::newSeed(),
+                                        passes, stride);
       break;
     }
     case 10: {
@@ -230,6 +249,8 @@ void runTest(int testNum) {
       break;
   }
 
+  MemoryBus.endSession();
+
   if (aTestExecuted) {
     println(TO_LCD, F("Test completed successfully."));
     println(TO_LCD, F("Total Errors: "), testResult.totalErrors);
@@ -303,6 +324,9 @@ void handleMainMenuInput(const char *input) {
     case 'R':
       streamMemory(false);
       break;
+    case 's':
+      searchMemory();
+      break;
     case 't':
       Menu::push(Menu::NodeID::RAM_TESTS);
       break;
@@ -575,6 +599,62 @@ void streamMemory(bool inHex) {
   printSeparator(TO_LCD, F("End of memory stream"), '-', 30, 0);
 }
 
+// Search the whole address space (ROM, VRAM and DRAM) for a pattern
+#define SEARCH_MAX_HITS 16
+static_assert(MEMORY_SCRATCH_SIZE >= SEARCH_MIN_BUFFER, "Search must fit the scratch");
+
+void searchMemory() {
+  println(TO_LCD, F("Enter: \"text\" or hex bytes (e.g. \"READY\" or c3h,00h,06h):"));
+  print(TO_LCD, F("> "));
+  serialFlush();
+
+  char *tokens[MAX_INPUT_PARAMETERS];
+  uint8_t nTok = readSerialInputParse(tokens, MAX_INPUT_PARAMETERS);
+  if (nTok == 0 || tokens[0][0] == '\0') {
+    println(TO_LCD, F("Error: enter a text in quotes or bytes separated by commas."));
+    return;
+  }
+
+  // Quoted text (white-space is stripped by the parser), else one byte per token
+  bool valid;
+  if (tokens[0][0] == '"' || tokens[0][0] == '\'') {
+    valid = PatternSearch.begin(tokens[0]);
+  } else {
+    uint8_t pattern[MAX_INPUT_PARAMETERS];
+    for (uint8_t i = 0; i < nTok; i++) {
+      pattern[i] = (uint8_t)strToUint16(tokens[i]);
+    }
+    valid = PatternSearch.begin(pattern, nTok);
+  }
+  if (!valid) {
+    println(TO_LCD, F("Error: pattern must be 1 to "), SEARCH_MAX_PATTERN, F(" bytes."));
+    return;
+  }
+
+  if (!MemoryBus.beginSession()) {
+    println(TO_LCD, F("Error: memory bus not available (TEST signal inactive?)."));
+    return;
+  }
+
+  printSeparator(TO_LCD, F("[RAM] Searching memory"), '-', 30, 0);
+  uint32_t started = millis();
+  uint8_t hits = 0;
+  uint32_t from = 0;
+  uint16_t address;
+  while (from < 0x10000UL && hits < SEARCH_MAX_HITS &&
+         PatternSearch.find(from, 0x10000UL, address, MemoryBus.getScratch(),
+                            MEMORY_SCRATCH_SIZE)) {
+    println(TO_LCD, F("Found at: "), address, Hex);
+    hits++;
+    from = (uint32_t)address + 1;
+  }
+  MemoryBus.endSession();
+
+  println(TO_LCD, F("Matches: "), hits);
+  println(TO_LCD, F("Time (ms): "), millis() - started);
+  printSeparator(TO_LCD, F("End of search"), '-', 30, 0);
+}
+
 void gameUpload() {
   uint16_t start_addr = 0x5200;
   uint16_t data_size = sizeof(alninvbh_code);
@@ -592,33 +672,51 @@ void uploadData() {
   println(TO_LCD, F("[RAM] uploadData() - TODO"));
 }
 
-#define INIT_TEST_RESULT TestResult result = {}
-#define UPDATE_ERRORS(diff)           \
-  if (diff != 0) {                    \
-    result.totalErrors++;             \
-    for (uint8_t b = 0; b < 8; b++) { \
-      if (diff & (1 << b))            \
-        result.bitErrors[b]++;        \
-    }                                 \
+// Iterate a range in MEMORY_PAGE_SIZE bursts
+#define FOR_EACH_PAGE(start, length, address, count)                                   \
+  for (uint32_t _offset = 0, address = (start), count = pageCount(length, 0);          \
+       _offset < (length);                                                             \
+       _offset += MEMORY_PAGE_SIZE, address = (start) + _offset,                       \
+                count = pageCount(length, _offset))
+
+// Shared page buffer for all tests
+static uint8_t _pageBuffer[MEMORY_PAGE_SIZE];
+
+// Number of bytes in the page at offset (the last page may be partial)
+static inline uint16_t pageCount(uint16_t length, uint32_t offset) {
+  if (offset >= length) {
+    return 0;
   }
+  uint32_t remaining = length - offset;
+  return remaining < MEMORY_PAGE_SIZE ? remaining : MEMORY_PAGE_SIZE;
+}
+
+// Accumulate the differences between a page read back and a constant expected value
+static inline void verifyPage(TestResult &result, const uint8_t *data, uint8_t expected,
+                              uint16_t count) {
+  ErrorCounter errors = {};
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t diff = data[i] ^ expected;
+    UPDATE_ERRORS(diff);
+  }
+  FLUSH_ERRORS;
+}
 
 TestResult runRepeatedWriteTest(uint16_t start, uint16_t length, bool toggleStart) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("Repeated Write Test");
 
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
+  FOR_EACH_PAGE(start, length, address, count) {
     for (uint16_t j = 0; j < 5; j++) {
-      Model1.writeMemory(start + i, 0x55);
+      MemoryBus.fillPage(address, 0x55, count);
     }
   }
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x55;
-    UPDATE_ERRORS(diff);
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.readPage(address, _pageBuffer, count);
+    verifyPage(result, _pageBuffer, 0x55, count);
   }
   Serial.println();
 
@@ -626,22 +724,20 @@ TestResult runRepeatedWriteTest(uint16_t start, uint16_t length, bool toggleStar
 }
 
 TestResult runRepeatedReadTest(uint16_t start, uint16_t length, bool toggleStart) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("Repeated Read Test");
 
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, 0x55);
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.fillPage(address, 0x55, count);
   }
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
+  FOR_EACH_PAGE(start, length, address, count) {
     for (uint16_t j = 0; j < 5; j++) {
-      data = Model1.readMemory(start + i);
+      MemoryBus.readPage(address, _pageBuffer, count);
     }
-    uint8_t diff = data ^ 0x55;
-    UPDATE_ERRORS(diff);
+    verifyPage(result, _pageBuffer, 0x55, count);
   }
   Serial.println();
 
@@ -649,8 +745,8 @@ TestResult runRepeatedReadTest(uint16_t start, uint16_t length, bool toggleStart
 }
 
 TestResult runCheckerboardTest(uint16_t start, uint16_t length, bool toggleStart) {
-  uint8_t data;
   INIT_TEST_RESULT;
+  ErrorCounter errors = {};
 
   Serial.print("Checkerboard Test");
   if (toggleStart) {
@@ -659,34 +755,32 @@ TestResult runCheckerboardTest(uint16_t start, uint16_t length, bool toggleStart
     Serial.print("(inverted)");
   }
 
+  // Pages start on even offsets, so the pattern is the same for every page
+  const uint8_t even = toggleStart ? 0x55 : 0xAA;
+  const uint8_t odd = toggleStart ? 0xAA : 0x55;
+
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    bool toggle = (i & 1) ? !toggleStart : toggleStart;
-    if (toggle) {
-      Model1.writeMemory(start + i, 0x55);
-    } else {
-      Model1.writeMemory(start + i, 0xAA);
-    }
+  for (uint16_t i = 0; i < MEMORY_PAGE_SIZE; i++) {
+    _pageBuffer[i] = (i & 1) ? odd : even;
+  }
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.writePage(address, _pageBuffer, count);
   }
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    bool toggle = (i & 1) ? !toggleStart : toggleStart;
-    data = Model1.readMemory(start + i);
-    if (toggle) {
-      uint8_t diff = data ^ 0x55;
-      UPDATE_ERRORS(diff);
-    } else {
-      uint8_t diff = data ^ 0xAA;
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.readPage(address, _pageBuffer, count);
+    for (uint16_t i = 0; i < count; i++) {
+      uint8_t diff = _pageBuffer[i] ^ ((i & 1) ? odd : even);
       UPDATE_ERRORS(diff);
     }
   }
+  FLUSH_ERRORS;
   Serial.println();
 
   return result;
 }
 
 TestResult runWalkingOnesTest(uint16_t start, uint16_t length) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("Walking Ones Test");
@@ -696,15 +790,14 @@ TestResult runWalkingOnesTest(uint16_t start, uint16_t length) {
     Serial.print(".");
 
     // Write
-    for (uint16_t i = 0; i < length; i++) {
-      Model1.writeMemory(start + i, pattern);
+    FOR_EACH_PAGE(start, length, address, count) {
+      MemoryBus.fillPage(address, pattern, count);
     }
 
     // Read
-    for (uint16_t i = 0; i < length; i++) {
-      data = Model1.readMemory(start + i);
-      uint8_t diff = data ^ pattern;
-      UPDATE_ERRORS(diff);
+    FOR_EACH_PAGE(start, length, address, count) {
+      MemoryBus.readPage(address, _pageBuffer, count);
+      verifyPage(result, _pageBuffer, pattern, count);
     }
   }
   Serial.println();
@@ -713,7 +806,6 @@ TestResult runWalkingOnesTest(uint16_t start, uint16_t length) {
 }
 
 TestResult runWalkingZerosTest(uint16_t start, uint16_t length) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("Walking Zeros Test");
@@ -723,15 +815,14 @@ TestResult runWalkingZerosTest(uint16_t start, uint16_t length) {
     Serial.print(".");
 
     // Write
-    for (uint16_t i = 0; i < length; i++) {
-      Model1.writeMemory(start + i, pattern);
+    FOR_EACH_PAGE(start, length, address, count) {
+      MemoryBus.fillPage(address, pattern, count);
     }
 
     // Read
-    for (uint16_t i = 0; i < length; i++) {
-      data = Model1.readMemory(start + i);
-      uint8_t diff = data ^ pattern;
-      UPDATE_ERRORS(diff);
+    FOR_EACH_PAGE(start, length, address, count) {
+      MemoryBus.readPage(address, _pageBuffer, count);
+      verifyPage(result, _pageBuffer, pattern, count);
     }
   }
   Serial.println();
@@ -740,89 +831,41 @@ TestResult runWalkingZerosTest(uint16_t start, uint16_t length) {
 }
 
 TestResult runMarchCTest(uint16_t start, uint16_t length) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("March C- Test");
 
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, 0x00);
-  }
-
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0xFF);
-  }
-
-  Serial.print(".");
-  for (int16_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0xFF;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0x00);
-  }
-
-  Serial.print(".");
-  for (int16_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-  }
-  Serial.println();
+  MarchTest::run(MARCH_SUITE_C, MARCH_SUITE_C_COUNT, start, length, 0x00, result, &Serial);
 
   return result;
 }
 
 TestResult runMovingInversionTest(uint16_t start, uint16_t length, uint8_t pattern) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("Moving Inversion Test (0x");
   Serial.print(pattern, HEX);
   Serial.print(")");
 
-  // First pattern: 0x00
-  uint8_t antipattern = ~pattern;
+  // The pattern is the background, its inverse the "1" of the element table
+  MarchTest::run(MOVING_INVERSION, MOVING_INVERSION_COUNT, start, length, pattern, result, &Serial);
 
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, pattern);
-  }
-
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ pattern;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, antipattern);
-  }
+  return result;
+}
 
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ antipattern;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, pattern);
-  }
+TestResult runRandomPatternTest(uint16_t start, uint16_t length, uint16_t seed, uint16_t passes,
+                                uint16_t stride) {
+  INIT_TEST_RESULT;
 
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ pattern;
-    UPDATE_ERRORS(diff);
-  }
-  Serial.println();
+  // Every address gets its own value; the printed seed replays the run exactly
+  Serial.print("Moving Inversion Test (random)");
+  RandomPattern::run(start, length, seed, passes, stride, result, &Serial);
 
   return result;
 }
 
 TestResult runRetentionTest(uint16_t start, uint16_t length, uint8_t pattern, uint32_t delayMs,
                             uint8_t repeatDelay) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("Retention Test (0x");
@@ -831,8 +874,8 @@ TestResult runRetentionTest(uint16_t start, uint16_t length, uint8_t pattern, ui
 
   // Fill with pattern
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, pattern);
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.fillPage(address, pattern, count);
   }
 
   for (uint16_t i = 0; i < repeatDelay; i++) {
@@ -841,10 +884,9 @@ TestResult runRetentionTest(uint16_t start, uint16_t length, uint8_t pattern, ui
   }
   // Verify
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ pattern;
-    UPDATE_ERRORS(diff);
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.readPage(address, _pageBuffer, count);
+    verifyPage(result, _pageBuffer, pattern, count);
   }
   Serial.println();
 
@@ -852,111 +894,29 @@ TestResult runRetentionTest(uint16_t start, uint16_t length, uint8_t pattern, ui
 }
 
 TestResult runMarchSSTest(uint16_t start, uint16_t length) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("March SS Test");
 
-  // Phase 1: Up write 0
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, 0x00);
-  }
-
-  // Phase 2: Up read 0, write 1
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0xFF);
-  }
-
-  // Phase 3: Down read 1, write 0
-  Serial.print(".");
-  for (int16_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0xFF;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0x00);
-  }
-
-  // Phase 4: Down read 0, write 1
-  Serial.print(".");
-  for (int16_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0xFF);
-  }
-
-  // Phase 5: Up read 1, write 0
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0xFF;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0x00);
-  }
-
-  // Phase 6: Up read 0
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-  }
-  Serial.println();
+  MarchTest::run(MARCH_SUITE_SS, MARCH_SUITE_SS_COUNT, start, length, 0x00, result, &Serial);
 
   return result;
 }
 
 TestResult runMarchLATest(uint16_t start, uint16_t length) {
-  uint8_t data;
   INIT_TEST_RESULT;
 
   Serial.print("March LA Test");
 
-  // Phase 1: Up write 0
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, 0x00);
-  }
-
-  // Phase 2: Up read 0, write 1
-  Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0xFF);
-  }
-
-  // Phase 3: Down read 1, write 0
-  Serial.print(".");
-  for (int32_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0xFF;
-    UPDATE_ERRORS(diff);
-    Model1.writeMemory(start + i, 0x00);
-  }
-
-  // Phase 4: Down read 0
-  Serial.print(".");
-  for (int32_t i = length - 1; i >= 0; i--) {
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ 0x00;
-    UPDATE_ERRORS(diff);
-  }
-  Serial.println();
+  MarchTest::run(MARCH_SUITE_LA, MARCH_SUITE_LA_COUNT, start, length, 0x00, result, &Serial);
 
   return result;
 }
 
 TestResult runReadDestructiveTest(uint16_t start, uint16_t length, uint8_t pattern,
                                   uint8_t numReads) {
-  uint8_t data;
   INIT_TEST_RESULT;
+  ErrorCounter errors = {};
 
   Serial.print("Read Destructive Fault Test (pattern 0x");
   Serial.print(pattern, HEX);
@@ -966,49 +926,61 @@ TestResult runReadDestructiveTest(uint16_t start, uint16_t length, uint8_t patte
 
   // 1. Fill memory with pattern
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    Model1.writeMemory(start + i, pattern);
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.fillPage(address, pattern, count);
   }
 
-  // 2. Repeatedly read the same cell without re-writing
-  for (uint16_t i = 0; i < length; i++) {
+  // 2. Repeatedly read the same cells without re-writing; each cell is counted
+  //    at most once (on its first failing read)
+  uint8_t failed[MEMORY_PAGE_SIZE / 8];
+  FOR_EACH_PAGE(start, length, address, count) {
+    memset(failed, 0, sizeof(failed));
     for (uint8_t r = 0; r < numReads; r++) {
-      data = Model1.readMemory(start + i);
-      uint8_t diff = data ^ pattern;
-      UPDATE_ERRORS(diff);
-      if (diff != 0) {
-        break;
+      MemoryBus.readPage(address, _pageBuffer, count);
+      for (uint16_t i = 0; i < count; i++) {
+        uint8_t diff = _pageBuffer[i] ^ pattern;
+        if (diff != 0 && !(failed[i >> 3] & (1 << (i & 7)))) {
+          failed[i >> 3] |= (1 << (i & 7));
+          UPDATE_ERRORS(diff);
+        }
       }
     }
   }
+  FLUSH_ERRORS;
   Serial.println();
 
   return result;
 }
 
 TestResult runAddressUniquenessTest(uint16_t start, uint16_t length, uint8_t pattern) {
-  uint8_t data;
   INIT_TEST_RESULT;
+  ErrorCounter errors = {};
 
   Serial.print("Address Uniqueness Test (XOR pattern 0x");
   Serial.print(pattern, HEX);
   Serial.print(")");
 
+  // Pages are 256 bytes, so the low address byte equals the page index
+  for (uint16_t i = 0; i < MEMORY_PAGE_SIZE; i++) {
+    _pageBuffer[i] = ((uint8_t)(i & 0xFF)) ^ pattern;
+  }
+
   // Phase 1: Write unique XOR pattern
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    uint8_t value = ((uint8_t)(i & 0xFF)) ^ pattern;
-    Model1.writeMemory(start + i, value);
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.writePage(address, _pageBuffer, count);
   }
 
   // Phase 2: Verify
   Serial.print(".");
-  for (uint16_t i = 0; i < length; i++) {
-    uint8_t expected = ((uint8_t)(i & 0xFF)) ^ pattern;
-    data = Model1.readMemory(start + i);
-    uint8_t diff = data ^ expected;
-    UPDATE_ERRORS(diff);
+  FOR_EACH_PAGE(start, length, address, count) {
+    MemoryBus.readPage(address, _pageBuffer, count);
+    for (uint16_t i = 0; i < count; i++) {
+      uint8_t diff = _pageBuffer[i] ^ (((uint8_t)(i & 0xFF)) ^ pattern);
+      UPDATE_ERRORS(diff);
+    }
   }
+  FLUSH_ERRORS;
   Serial.println();
 
   return result;
@@ -1017,6 +989,11 @@ TestResult runAddressUniquenessTest(uint16_t start, uint16_t length, uint8_t pat
 TestSuiteResult runMemoryTestSuite(uint16_t start, uint16_t length) {
   TestSuiteResult suite = {};
 
+  if (!MemoryBus.beginSession()) {
+    Serial.println("Error: memory bus not available (TEST signal inactive?).");
+    return suite;
+  }
+
   suite.repeatedWriteNormal = runRepeatedWriteTest(start, length, true);
   suite.repeatedWriteInverted = runRepeatedWriteTest(start, length, false);
   suite.repeatedReadNormal = runRepeatedReadTest(start, length, true);
@@ -1028,7 +1005,9 @@ TestSuiteResult runMemoryTestSuite(uint16_t start, uint16_t length) {
   suite.marchC = runMarchCTest(start, length);
   suite.movingInversionZero = runMovingInversionTest(start, length, 0x00);
   suite.movingInversion55 = runMovingInversionTest(start, length, 0x55);
-  suite.movingInversionRandom = runMovingInversionTest(start, length, random(0, 255));
+  suite.movingInversionRandom = runRandomPatternTest(start, length, RandomPattern::newSeed(),
+                                                     RANDOM_PATTERN_DEFAULT_PASSES,
+                                                     RANDOM_PATTERN_DEFAULT_STRIDE);
   suite.marchSS = runMarchSSTest(start, length);
   suite.marchLA = runMarchLATest(start, length);
   suite.readDestructiveAA = runReadDestructiveTest(start, length, 0xAA, 5);
@@ -1037,6 +1016,8 @@ TestSuiteResult runMemoryTestSuite(uint16_t start, uint16_t length) {
   suite.addressUniquenessAA = runAddressUniquenessTest(start, length, 0xAA);
   suite.retention = runRetentionTest(start, length, 0xFF, 1000, 5);
 
+  MemoryBus.endSession();
+
   return suite;
 }
 
@@ -1057,6 +1038,7 @@ void printResult(const char *name, const TestResult &r, const char *icRefs[8]) {
 void runAndEvaluate(uint16_t start, uint16_t length, const char *icRefs[8]) {
   Serial.println("=== START MEMORY TEST SUITE ===");
 
+  MemoryBus.resetStats();
   TestSuiteResult suite = runMemoryTestSuite(start, length);
 
   // Serial.println();
@@ -1132,6 +1114,12 @@ void runAndEvaluate(uint16_t start, uint16_t length, const char *icRefs[8]) {
   Serial.print("Total Errors Across All Tests: ");
   Serial.println(totalErrorsOverall);
 
+  Serial.print("Throughput: ");
+  Serial.print(MemoryBus.getBytesPerSecond());
+  Serial.print(" bytes/s (");
+  Serial.print(MemoryBus.getBusOperations());
+  Serial.println(" ops)");
+
   Serial.println("=== END MEMORY TEST SUITE ===");
 }
 
@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 
+#include "../M1TestHarness/memory/TestResult.h"
 #include "globals_th.h"
 #include "menu_th.h"
 #include "utils_th.h"
@@ -10,10 +11,8 @@
 namespace RamTH {
 
 /* ---------- Memory Test Structures ---------- */
-struct TestResult {
-  uint32_t totalErrors;
-  uint32_t bitErrors[8];  // bitErrors[0] = failures of bit 0, etc.
-};
+// Shared with the M1TestHarness memory engine
+typedef ::TestResult TestResult;
 
 struct TestSuiteResult {
   TestResult repeatedWriteNormal;
@@ -59,6 +58,7 @@ void readHex();         // r
 void readAscii();       // R
 void uploadData();      // u
 void streamMemory(bool hex = false);
+void searchMemory();  // s
 
 void fillMemoryByte();     // f
 void fillMemoryPattern();  // F
@@ -71,6 +71,8 @@ TestResult runWalkingOnesTest(uint16_t start, uint16_t length);
 TestResult runWalkingZerosTest(uint16_t start, uint16_t length);
 TestResult runMarchCTest(uint16_t start, uint16_t length);
 TestResult runMovingInversionTest(uint16_t start, uint16_t length, uint8_t pattern);
+TestResult runRandomPatternTest(uint16_t start, uint16_t length, uint16_t seed, uint16_t passes,
+                                uint16_t stride);
 TestResult runRetentionTest(uint16_t start, uint16_t length, uint8_t pattern, uint32_t delayMs,
                             uint8_t repeatDelay);
 TestResult runMarchSSTest(uint16_t start, uint16_t length);
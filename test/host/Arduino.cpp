@@ -0,0 +1,86 @@
+#include "Arduino.h"
+
+#include "SimBus.h"
+
+volatile uint8_t SREG;
+volatile uint8_t OCR2A, TCCR2A, TCCR2B, TIMSK2, TCNT2;
+
+unsigned long millis() {
+  return SimBus.getMicros() / 1000;
+}
+
+unsigned long micros() {
+  return SimBus.getMicros();
+}
+
+void delay(unsigned long ms) {
+  SimBus.elapse(ms * 1000);
+}
+
+void delayMicroseconds(unsigned int us) {
+  SimBus.elapse(us);
+}
+
+// Fixed LCG so random patterns repeat from run to run
+static uint32_t randomState = 1;
+
+void randomSeed(unsigned long seed) {
+  randomState = seed ? seed : 1;
+}
+
+long random(long howBig) {
+  if (howBig <= 0) {
+    return 0;
+  }
+  randomState = randomState * 1103515245UL + 12345UL;
+  return (long)((randomState >> 8) % (uint32_t)howBig);
+}
+
+long random(long howSmall, long howBig) {
+  return (howSmall >= howBig) ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+size_t Print::print(const __FlashStringHelper *s) {
+  return print(reinterpret_cast<const char *>(s));
+}
+
+size_t Print::print(const char *s) {
+  size_t n = 0;
+  while (*s) {
+    n += write((uint8_t)*s++);
+  }
+  return n;
+}
+
+size_t Print::print(char c) {
+  return write((uint8_t)c);
+}
+
+size_t Print::print(unsigned char n, int base) {
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(int n, int base) {
+  return print((long)n, base);
+}
+
+size_t Print::print(unsigned int n, int base) {
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(long n, int base) {
+  if (n < 0 && base == DEC) {
+    return print('-') + print((unsigned long)-n, base);
+  }
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  char buffer[24];
+  snprintf(buffer, sizeof(buffer), (base == HEX) ? "%lX" : "%lu", n);
+  return print(buffer);
+}
+
+size_t Print::println() {
+  return write('\n');
+}
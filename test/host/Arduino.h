@@ -0,0 +1,80 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+/**
+ * Host stand-in for the parts of the Arduino core the memory layer uses.
+ *
+ * PROGMEM is plain memory, interrupts do nothing and time is the simulated
+ * clock of SimBus (see SimBus.h), so runs are exact and repeatable.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(void *const *)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
+
+#define HEX 16
+#define DEC 10
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+
+class __FlashStringHelper;
+
+// Status register and refresh timer (no interrupts on the host)
+extern volatile uint8_t SREG;
+extern volatile uint8_t OCR2A, TCCR2A, TCCR2B, TIMSK2, TCNT2;
+#define OCIE2A 1
+inline void cli() {}
+inline void sei() {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+// Simulated time
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Deterministic random numbers
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+
+  size_t print(const __FlashStringHelper *s);
+  size_t print(const char *s);
+  size_t print(char c);
+  size_t print(unsigned char n, int base = DEC);
+  size_t print(int n, int base = DEC);
+  size_t print(unsigned int n, int base = DEC);
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t println();
+  template <typename T>
+  size_t println(T value) {
+    return print(value) + println();
+  }
+  template <typename T>
+  size_t println(T value, int base) {
+    return print(value, base) + println();
+  }
+};
+
+#endif  // HOST_ARDUINO_H
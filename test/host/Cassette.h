@@ -0,0 +1,12 @@
+#ifndef HOST_CASSETTE_H
+#define HOST_CASSETTE_H
+
+#include <SerialLogger.h>
+
+// Only needed to compile globals.h on the host
+class Cassette {
+ public:
+  void setLogger(SerialLogger &logger) {}
+};
+
+#endif  // HOST_CASSETTE_H
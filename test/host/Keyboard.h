@@ -0,0 +1,12 @@
+#ifndef HOST_KEYBOARD_H
+#define HOST_KEYBOARD_H
+
+#include <SerialLogger.h>
+
+// Only needed to compile globals.h on the host
+class Keyboard {
+ public:
+  void setLogger(SerialLogger &logger) {}
+};
+
+#endif  // HOST_KEYBOARD_H
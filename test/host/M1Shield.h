@@ -0,0 +1,14 @@
+#ifndef HOST_M1_SHIELD_H
+#define HOST_M1_SHIELD_H
+
+#include <SerialLogger.h>
+
+// Only needed to compile globals.h on the host
+class M1ShieldClass {
+ public:
+  void setLogger(SerialLogger &logger) {}
+};
+
+extern M1ShieldClass M1Shield;
+
+#endif  // HOST_M1_SHIELD_H
@@ -0,0 +1,21 @@
+#ifndef HOST_MODEL1_H
+#define HOST_MODEL1_H
+
+#include <Arduino.h>
+
+class SerialLogger;
+
+// The TEST signal is always granted on the simulated bus
+class Model1Class {
+ public:
+  void setLogger(SerialLogger &logger) {}
+  void activateTestSignal() {}
+  void deactivateTestSignal() {}
+  bool hasActiveTestSignal() { return true; }
+  void activateMemoryRefresh() {}
+  void deactivateMemoryRefresh() {}
+};
+
+extern Model1Class Model1;
+
+#endif  // HOST_MODEL1_H
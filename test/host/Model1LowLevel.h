@@ -0,0 +1,25 @@
+#ifndef HOST_MODEL1_LOW_LEVEL_H
+#define HOST_MODEL1_LOW_LEVEL_H
+
+#include <Arduino.h>
+
+#include "SimBus.h"
+
+// Pin-level bus of the simulated Model I: every RD/WR falling edge is one
+// access of SimBus, exactly as the real strobes are one DRAM cycle each
+class Model1LowLevel {
+ public:
+  static void configWriteAddressBus(uint16_t outputs) {}
+  static void writeAddressBus(uint16_t address) { SimBus.setAddress(address); }
+
+  static void configWriteDataBus(uint8_t outputs) { SimBus.setDataOutput(outputs != 0); }
+  static void writeDataBus(uint8_t data) { SimBus.setData(data); }
+  static uint8_t readDataBus() { return SimBus.getData(); }
+
+  static void configWriteRD(uint8_t mode) { SimBus.setReadOutput(mode == OUTPUT); }
+  static void writeRD(uint8_t level) { SimBus.strobeRead(level); }
+  static void configWriteWR(uint8_t mode) { SimBus.setWriteOutput(mode == OUTPUT); }
+  static void writeWR(uint8_t level) { SimBus.strobeWrite(level); }
+};
+
+#endif  // HOST_MODEL1_LOW_LEVEL_H
@@ -0,0 +1,12 @@
+#ifndef HOST_ROM_H
+#define HOST_ROM_H
+
+#include <SerialLogger.h>
+
+// Only needed to compile globals.h on the host
+class ROM {
+ public:
+  void setLogger(SerialLogger &logger) {}
+};
+
+#endif  // HOST_ROM_H
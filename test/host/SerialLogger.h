@@ -0,0 +1,14 @@
+#ifndef HOST_SERIAL_LOGGER_H
+#define HOST_SERIAL_LOGGER_H
+
+#include <Arduino.h>
+
+// Log messages of the memory layer are dropped on the host
+class SerialLogger {
+ public:
+  void infoF(const __FlashStringHelper *format, ...) {}
+  void warnF(const __FlashStringHelper *format, ...) {}
+  void errF(const __FlashStringHelper *format, ...) {}
+};
+
+#endif  // HOST_SERIAL_LOGGER_H
@@ -0,0 +1,190 @@
+#include "SimBus.h"
+
+#include <string.h>
+
+SimBusClass SimBus;
+
+static const char *const FAULT_NAMES[SIM_FAULT_TYPE_COUNT] = {
+    "none",     "stuck-at",  "transition",   "coupling",
+    "aliasing", "retention", "read-disturb", "row-hammer"};
+
+SimBusClass::SimBusClass() {
+  reset();
+}
+
+void SimBusClass::reset(uint8_t fill) {
+  memset(_memory, fill, sizeof(_memory));
+  memset(&_fault, 0, sizeof(_fault));
+  _lastWrite = 0;
+  _readsInRow = 0;
+  _hammered = 0;
+
+  _address = 0;
+  _dataOut = 0;
+  _dataIn = 0xFF;
+  _dataOutput = false;
+  _rd = 1;
+  _wr = 1;
+  _rdOutput = false;
+  _wrOutput = false;
+
+  _micros = 0;
+  resetCounts();
+}
+
+void SimBusClass::inject(const SimFault &fault) {
+  _fault = fault;
+  _lastWrite = _micros;
+  _readsInRow = 0;
+  _hammered = 0;
+}
+
+const char *SimBusClass::getFaultName(uint8_t type) {
+  return (type < SIM_FAULT_TYPE_COUNT) ? FAULT_NAMES[type] : "?";
+}
+
+uint32_t SimBusClass::getReads() const {
+  return _reads;
+}
+
+uint32_t SimBusClass::getWrites() const {
+  return _writes;
+}
+
+uint32_t SimBusClass::getOperations() const {
+  return _reads + _writes;
+}
+
+void SimBusClass::resetCounts() {
+  _reads = 0;
+  _writes = 0;
+}
+
+void SimBusClass::elapse(uint32_t micros) {
+  _micros += micros;
+}
+
+uint32_t SimBusClass::getMicros() const {
+  return _micros;
+}
+
+void SimBusClass::setAddress(uint16_t address) {
+  _address = address;
+}
+
+void SimBusClass::setDataOutput(bool output) {
+  _dataOutput = output;
+}
+
+void SimBusClass::setData(uint8_t data) {
+  _dataOut = data;
+}
+
+uint8_t SimBusClass::getData() const {
+  // Nothing drives the bus for the board while the harness does
+  return _dataOutput ? _dataOut : _dataIn;
+}
+
+void SimBusClass::setReadOutput(bool output) {
+  _rdOutput = output;
+}
+
+void SimBusClass::setWriteOutput(bool output) {
+  _wrOutput = output;
+}
+
+void SimBusClass::strobeRead(uint8_t level) {
+  if (_rdOutput && _rd && !level) {
+    _dataIn = _read(_address);
+    _reads++;
+    _micros += SIM_BUS_CYCLE_MICROS;
+  }
+  _rd = level;
+}
+
+void SimBusClass::strobeWrite(uint8_t level) {
+  if (_wrOutput && _wr && !level) {
+    _write(_address, _dataOut);
+    _writes++;
+    _micros += SIM_BUS_CYCLE_MICROS;
+  }
+  _wr = level;
+}
+
+uint16_t SimBusClass::_decode(uint16_t address) const {
+  if (_fault.type == SIM_FAULT_ALIASING && address == _fault.address) {
+    return _fault.other;
+  }
+  return address;
+}
+
+void SimBusClass::_activate(uint16_t cell) {
+  // Every access opens the row of its cell
+  if (_fault.type != SIM_FAULT_ROW_HAMMER || (cell >> 14) != (_fault.address >> 14)) {
+    return;
+  }
+  uint8_t row = cell & 0x7F;
+  uint8_t victim = _fault.address & 0x7F;
+  if (row == victim) {
+    _hammered = 0;
+  } else if (row + 1 == victim || row == victim + 1) {
+    if (++_hammered >= _fault.param) {
+      uint8_t mask = 1 << _fault.bit;
+      _memory[_fault.address] = (_memory[_fault.address] & ~mask) | (_fault.value ? mask : 0);
+      _hammered = 0;
+    }
+  }
+}
+
+uint8_t SimBusClass::_read(uint16_t address) {
+  uint16_t cell = _decode(address);
+  _activate(cell);
+  uint8_t mask = 1 << _fault.bit;
+  uint8_t forced = _fault.value ? mask : 0;
+
+  if (cell == _fault.address) {
+    switch (_fault.type) {
+      case SIM_FAULT_RETENTION:
+        if (_micros - _lastWrite >= _fault.param * 1000) {
+          _memory[cell] = (_memory[cell] & ~mask) | forced;
+        }
+        break;
+      case SIM_FAULT_READ_DISTURB:
+        if (++_readsInRow >= _fault.param) {
+          _memory[cell] ^= mask;
+          _readsInRow = 0;
+        }
+        break;
+    }
+  } else if (_fault.type == SIM_FAULT_READ_DISTURB) {
+    _readsInRow = 0;
+  }
+
+  uint8_t data = _memory[cell];
+  if (_fault.type == SIM_FAULT_STUCK_AT && cell == _fault.address) {
+    data = (data & ~mask) | forced;
+  }
+  return data;
+}
+
+void SimBusClass::_write(uint16_t address, uint8_t data) {
+  uint16_t cell = _decode(address);
+  _activate(cell);
+  uint8_t mask = 1 << _fault.bit;
+  uint8_t forced = _fault.value ? mask : 0;
+  uint8_t old = _memory[cell];
+
+  if (cell == _fault.address) {
+    if (_fault.type == SIM_FAULT_TRANSITION && ((old ^ data) & mask) && (data & mask) == forced) {
+      data = (data & ~mask) | (old & mask);
+    }
+    _lastWrite = _micros;
+    _readsInRow = 0;
+  }
+  _memory[cell] = data;
+
+  if (_fault.type == SIM_FAULT_COUPLING && cell == _fault.other && !(old & mask) &&
+      (data & mask)) {
+    _memory[_fault.address] = (_memory[_fault.address] & ~mask) | forced;
+  }
+}
@@ -0,0 +1,109 @@
+#ifndef SIM_BUS_H
+#define SIM_BUS_H
+
+#include <stdint.h>
+
+/**
+ * SimBus - Simulated Model I bus with injectable memory faults
+ *
+ * Stands behind Model1LowLevel on the host, so the real MemoryBus and every
+ * test above it run unchanged: the address and data pins are latched and each
+ * falling RD/WR strobe is one access of a flat 64K memory. Strobes are counted
+ * (the exact bus operations of a test) and advance the simulated clock by
+ * SIM_BUS_CYCLE_MICROS, which is also what millis()/micros() return. Strobes
+ * only count while their pin is configured as an output.
+ *
+ * One fault at a time can be injected into a cell (address) and data bit:
+ *
+ * - SIM_FAULT_STUCK_AT:     the bit always reads value
+ * - SIM_FAULT_TRANSITION:   the bit cannot change to value
+ * - SIM_FAULT_COUPLING:     the bit is forced to value whenever the same bit
+ *                           of the aggressor cell (other) rises
+ * - SIM_FAULT_ALIASING:     the address decodes to the cell of other
+ * - SIM_FAULT_RETENTION:    the bit decays to value param ms after a write
+ * - SIM_FAULT_READ_DISTURB: the bit flips on the param-th read in a row
+ * - SIM_FAULT_ROW_HAMMER:   the bit is forced to value after param
+ *                           activations of the rows next to its own without
+ *                           one of its own row (rows are A0-A6 of a 16K bank)
+ */
+
+// Simulated time of one bus access
+#define SIM_BUS_CYCLE_MICROS 1
+
+// Fault types
+#define SIM_FAULT_NONE 0
+#define SIM_FAULT_STUCK_AT 1
+#define SIM_FAULT_TRANSITION 2
+#define SIM_FAULT_COUPLING 3
+#define SIM_FAULT_ALIASING 4
+#define SIM_FAULT_RETENTION 5
+#define SIM_FAULT_READ_DISTURB 6
+#define SIM_FAULT_ROW_HAMMER 7
+#define SIM_FAULT_TYPE_COUNT 8
+
+struct SimFault {
+  uint8_t type;      // SIM_FAULT_*
+  uint16_t address;  // Faulty cell (victim)
+  uint8_t bit;       // Faulty data bit
+  uint8_t value;     // Value the bit is stuck at, cannot reach or is forced to
+  uint16_t other;    // Aggressor (coupling) or decoded cell (aliasing)
+  uint32_t param;    // Hold time in ms (retention), reads in a row (read disturb),
+                     // neighbour activations (row hammer)
+};
+
+class SimBusClass {
+ public:
+  SimBusClass();
+
+  // Fault-free memory filled with fill, counters and clock back to zero
+  void reset(uint8_t fill = 0x00);
+  void inject(const SimFault &fault);
+  static const char *getFaultName(uint8_t type);
+
+  uint32_t getReads() const;
+  uint32_t getWrites() const;
+  uint32_t getOperations() const;
+  void resetCounts();
+
+  void elapse(uint32_t micros);
+  uint32_t getMicros() const;
+
+  // Pins (see Model1LowLevel.h)
+  void setAddress(uint16_t address);
+  void setDataOutput(bool output);
+  void setData(uint8_t data);
+  uint8_t getData() const;
+  void setReadOutput(bool output);
+  void setWriteOutput(bool output);
+  void strobeRead(uint8_t level);
+  void strobeWrite(uint8_t level);
+
+ private:
+  uint8_t _memory[0x10000];
+  SimFault _fault;
+  uint32_t _lastWrite;  // Of the faulty cell (retention)
+  uint32_t _readsInRow;  // Of the faulty cell (read disturb)
+  uint32_t _hammered;    // Neighbour activations since the faulty row was open (row hammer)
+
+  uint16_t _address;
+  uint8_t _dataOut;
+  uint8_t _dataIn;
+  bool _dataOutput;
+  uint8_t _rd;
+  uint8_t _wr;
+  bool _rdOutput;  // A released strobe pin does not reach the bus
+  bool _wrOutput;
+
+  uint32_t _reads;
+  uint32_t _writes;
+  uint32_t _micros;
+
+  uint16_t _decode(uint16_t address) const;
+  void _activate(uint16_t cell);
+  uint8_t _read(uint16_t address);
+  void _write(uint16_t address, uint8_t data);
+};
+
+extern SimBusClass SimBus;
+
+#endif  // SIM_BUS_H
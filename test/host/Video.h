@@ -0,0 +1,12 @@
+#ifndef HOST_VIDEO_H
+#define HOST_VIDEO_H
+
+#include <SerialLogger.h>
+
+// Only needed to compile globals.h on the host
+class Video {
+ public:
+  void setLogger(SerialLogger &logger) {}
+};
+
+#endif  // HOST_VIDEO_H
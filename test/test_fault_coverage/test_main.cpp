@@ -0,0 +1,535 @@
+/**
+ * Fault coverage benchmark of the DRAM tests on the simulated bus
+ *
+ * Runs every titled test of RAM_TEST_SUITE, NPSF, GALPAT and the topology
+ * tests over a 16K bank once fault-free and once per injected fault class
+ * (see host/SimBus.h), and prints which classes each test detects with its
+ * exact bus operations. Every fault class a suite test claims in its
+ * RAM_TEST_SUITE entry (what TestPlanner relies on) has to be detected.
+ *
+ * The tests that do not cover the whole bank the same way are checked on
+ * their own: the address line probe, the quick screen, row hammer, seed
+ * replay of the random tests and the pattern search.
+ *
+ * Run with: pio test -e native
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "../host/SimBus.h"
+
+// The memory layer is built as one unit, as arduino_ide_includes.h does
+#include "../../M1TestHarness/memory/AddressLineTest.cpp"
+#include "../../M1TestHarness/memory/DramTopology.cpp"
+#include "../../M1TestHarness/memory/FaultLog.cpp"
+#include "../../M1TestHarness/memory/GalpatTest.cpp"
+#include "../../M1TestHarness/memory/MarchTest.cpp"
+#include "../../M1TestHarness/memory/MemoryBus.cpp"
+#include "../../M1TestHarness/memory/NpsfTest.cpp"
+#include "../../M1TestHarness/memory/PatternSearch.cpp"
+#include "../../M1TestHarness/memory/QuickScreen.cpp"
+#include "../../M1TestHarness/memory/RandomPattern.cpp"
+#include "../../M1TestHarness/memory/RowHammerTest.cpp"
+#include "../../M1TestHarness/memory/SweepScheduler.cpp"
+#include "../../M1TestHarness/memory/TestSuite.cpp"
+#include "../host/Arduino.cpp"
+#include "../host/SimBus.cpp"
+
+// Host stand-ins for the globals of the sketch
+GlobalsClass::GlobalsClass() {}
+GlobalsClass Globals;
+Model1Class Model1;
+
+#define BANK_START 0x4000
+#define BANK_LENGTH DRAM_BANK_SIZE
+#define MATRIX_BITS 7
+
+// Simulated time per loop() of the console (delay elements elapse with it)
+#define LOOP_MICROS 1000
+
+// Victim cell, inside bank 0 at (row, column) away from the edges
+#define VICTIM 0x5A5A
+
+// Neighbour activations that flip the row hammer victim, and the hammer
+// count per aggressor: only both neighbours together get there
+#define HAMMER_THRESHOLD 1000
+#define HAMMER_COUNT 600
+
+// One fault of every class (index = SIM_FAULT_*)
+static const SimFault FAULTS[SIM_FAULT_TYPE_COUNT] = {
+    {SIM_FAULT_NONE, 0, 0, 0, 0, 0},
+    {SIM_FAULT_STUCK_AT, VICTIM, 3, 1, 0, 0},
+    {SIM_FAULT_TRANSITION, VICTIM, 5, 1, 0, 0},
+    {SIM_FAULT_COUPLING, VICTIM, 2, 1, 0x6123, 0},
+    {SIM_FAULT_ALIASING, VICTIM, 0, 0, 0x4A5A, 0},
+    {SIM_FAULT_RETENTION, VICTIM, 7, 0, 0, 2000},
+    {SIM_FAULT_READ_DISTURB, VICTIM, 1, 0, 0, 3},
+    {SIM_FAULT_ROW_HAMMER, VICTIM, 4, 1, 0, HAMMER_THRESHOLD},
+};
+
+// The same classes with the other polarity, or the aggressor and alias on the
+// other side; a suite test that claims a class has to detect one of the two
+static const SimFault OTHER_FAULTS[SIM_FAULT_TYPE_COUNT] = {
+    {SIM_FAULT_NONE, 0, 0, 0, 0, 0},
+    {SIM_FAULT_STUCK_AT, VICTIM, 3, 0, 0, 0},
+    {SIM_FAULT_TRANSITION, VICTIM, 5, 0, 0, 0},
+    {SIM_FAULT_COUPLING, VICTIM, 2, 1, 0x4123, 0},
+    {SIM_FAULT_ALIASING, VICTIM, 0, 0, 0x7A5A, 0},
+    {SIM_FAULT_RETENTION, VICTIM, 7, 1, 0, 2000},
+    {SIM_FAULT_READ_DISTURB, VICTIM, 1, 0, 0, 2},
+    {SIM_FAULT_ROW_HAMMER, VICTIM, 4, 0, 0, HAMMER_THRESHOLD},
+};
+
+// Simulated fault class of each PLAN_FAULT_* bit (NONE: not modelled)
+static const uint8_t PLAN_FAULT_SIM[8] = {
+    SIM_FAULT_STUCK_AT, SIM_FAULT_TRANSITION,   SIM_FAULT_COUPLING,  SIM_FAULT_ALIASING,
+    SIM_FAULT_NONE,     SIM_FAULT_READ_DISTURB, SIM_FAULT_RETENTION, SIM_FAULT_NONE,
+};
+
+// Tests beyond the titled suite tests
+#define BENCH_NPSF 0xF0
+#define BENCH_GALPAT 0xF1
+#define BENCH_TOPOLOGY 0xF2
+
+struct BenchRow {
+  char name[40];
+  uint32_t operations;  // Bus strobes of the fault-free run
+  uint32_t errors[SIM_FAULT_TYPE_COUNT];
+};
+
+static BenchRow rows[40];
+static uint8_t rowCount = 0;
+
+// Fresh memory with one fault and a bus session, as a console starts a test
+static void beginRun(const SimFault &fault) {
+  SimBus.reset();
+  SimBus.inject(fault);
+  MemoryBus.resetStats();
+  MemoryBus.beginSession();
+  FaultLog.begin(BANK_START, MATRIX_BITS, MATRIX_BITS);
+}
+
+// Ends the session; returns the strobes seen by the simulated bus
+static uint32_t endRun() {
+  MemoryBus.endSession();
+  TEST_ASSERT_EQUAL_UINT32(SimBus.getOperations(), MemoryBus.getBusOperations());
+  return SimBus.getOperations();
+}
+
+// Run one test over the bank; returns the strobes seen by the simulated bus
+static uint32_t runTest(uint8_t test, const SimFault &fault, TestResult &result,
+                        uint32_t &reported) {
+  beginRun(fault);
+  result = {};
+
+  if (test == BENCH_NPSF) {
+    NpsfTest npsf;
+    npsf.begin(BANK_START, BANK_LENGTH, MATRIX_BITS);
+    while (!npsf.isDone()) {
+      npsf.step(result);
+    }
+    reported = NpsfTest::getOperations(BANK_LENGTH);
+  } else if (test == BENCH_GALPAT) {
+    GalpatTest::run(BANK_START, 1, GALPAT_DEFAULT_WINDOW, result);
+    reported = GalpatTest::getOperations(GALPAT_DEFAULT_WINDOW, 1);
+  } else if (test == BENCH_TOPOLOGY) {
+    // Sliced like DRAMTopologyConsole::stepTest()
+    DramTopology::begin(BANK_START, 1);
+    while (!DramTopology::isDone()) {
+      DramTopology::step(result, 1024 / DRAM_ROWS);
+      SimBus.elapse(LOOP_MICROS);
+    }
+    reported = 0;
+    for (uint8_t t = 0; t < DRAM_TOPOLOGY_TEST_COUNT; t++) {
+      reported += DramTopology::getOperations(t, 1);
+    }
+  } else {
+    // Sliced like RAMTestSuiteConsole::stepRun()
+    SweepScheduler scheduler;
+    scheduler.setTestMask(1UL << test);
+    scheduler.begin(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, BANK_START, BANK_LENGTH);
+    while (!scheduler.isDone()) {
+      scheduler.step(result, 1024);
+      SimBus.elapse(LOOP_MICROS);
+    }
+    reported = scheduler.getOperations();
+  }
+
+  return endRun();
+}
+
+static void addRow(uint8_t test, const char *name) {
+  BenchRow &row = rows[rowCount++];
+  snprintf(row.name, sizeof(row.name), "%s", name);
+
+  for (uint8_t type = 0; type < SIM_FAULT_TYPE_COUNT; type++) {
+    TestResult result;
+    uint32_t reported = 0;
+    uint32_t operations = runTest(test, FAULTS[type], result, reported);
+
+    // The counts a console shows are the strobes that really happen
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(operations, reported, name);
+    if (type == SIM_FAULT_NONE) {
+      row.operations = operations;
+    }
+    row.errors[type] = result.totalErrors;
+  }
+}
+
+static void runBenchmark() {
+  if (rowCount > 0) {
+    return;
+  }
+  uint8_t titled = getSuiteTitledCount(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT);
+  for (uint8_t test = 0; test < titled; test++) {
+    addRow(test, (const char *)getSuiteTitle(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, test));
+  }
+  addRow(BENCH_NPSF, "NPSF (type-1)");
+  addRow(BENCH_GALPAT, "GALPAT (window 2)");
+  addRow(BENCH_TOPOLOGY, "DRAM topology (all orders)");
+}
+
+static const BenchRow *findRow(const char *name) {
+  for (uint8_t i = 0; i < rowCount; i++) {
+    if (strcmp(rows[i].name, name) == 0) {
+      return &rows[i];
+    }
+  }
+  TEST_FAIL_MESSAGE(name);
+  return nullptr;
+}
+
+static bool detects(const char *name, uint8_t type) {
+  return findRow(name)->errors[type] > 0;
+}
+
+void test_no_false_positives() {
+  runBenchmark();
+  for (uint8_t i = 0; i < rowCount; i++) {
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, rows[i].errors[SIM_FAULT_NONE], rows[i].name);
+  }
+}
+
+void test_march_tests_detect_static_faults() {
+  runBenchmark();
+  TEST_ASSERT_TRUE(detects("March C- Test", SIM_FAULT_STUCK_AT));
+  TEST_ASSERT_TRUE(detects("March C- Test", SIM_FAULT_TRANSITION));
+  TEST_ASSERT_TRUE(detects("March C- Test", SIM_FAULT_ALIASING));
+
+  // The suite's March C- stops after down(r1,w0); only the longer March SS
+  // sees an aggressor above the victim rise after the victim was written
+  TEST_ASSERT_FALSE(detects("March C- Test", SIM_FAULT_COUPLING));
+  TEST_ASSERT_TRUE(detects("March SS Test", SIM_FAULT_COUPLING));
+}
+
+void test_dynamic_faults_need_their_tests() {
+  runBenchmark();
+  TEST_ASSERT_TRUE(detects("Retention Test (0xFF)", SIM_FAULT_RETENTION));
+  TEST_ASSERT_FALSE(detects("March C- Test", SIM_FAULT_RETENTION));
+  TEST_ASSERT_TRUE(detects("Repeated Read Test", SIM_FAULT_READ_DISTURB));
+  TEST_ASSERT_TRUE(detects("Read Destructive Fault Test (0x55)", SIM_FAULT_READ_DISTURB));
+}
+
+void test_neighbourhood_tests_detect_coupling() {
+  runBenchmark();
+  TEST_ASSERT_TRUE(detects("NPSF (type-1)", SIM_FAULT_COUPLING));
+  TEST_ASSERT_TRUE(detects("NPSF (type-1)", SIM_FAULT_STUCK_AT));
+  TEST_ASSERT_TRUE(detects("GALPAT (window 2)", SIM_FAULT_STUCK_AT));
+}
+
+void test_topology_orders_detect_static_faults() {
+  runBenchmark();
+  TEST_ASSERT_TRUE(detects("DRAM topology (all orders)", SIM_FAULT_STUCK_AT));
+  TEST_ASSERT_TRUE(detects("DRAM topology (all orders)", SIM_FAULT_TRANSITION));
+  TEST_ASSERT_TRUE(detects("DRAM topology (all orders)", SIM_FAULT_ALIASING));
+}
+
+// A fault that decodes address onto the cell of other
+static SimFault aliasFault(uint16_t address, uint16_t other) {
+  SimFault fault = {SIM_FAULT_ALIASING, address, 0, 0, other, 0};
+  return fault;
+}
+
+void test_address_lines_stuck_and_shorted() {
+  AddressLineResult lines;
+
+  beginRun(FAULTS[SIM_FAULT_NONE]);
+  AddressLineTest::run(BANK_START, BANK_LENGTH, lines);
+  TEST_ASSERT_EQUAL_UINT32(lines.operations, endRun());
+  TEST_ASSERT_EQUAL_HEX16(0x3FFF, lines.tested);  // A0-A13 inside a 16K bank
+  TEST_ASSERT_EQUAL_HEX16(0, lines.stuck | lines.shorted);
+  TEST_ASSERT_EQUAL_UINT8(0, lines.dataErrors);
+
+  // A9 selects nothing: its probe lands on the base
+  beginRun(aliasFault(BANK_START ^ (1 << 9), BANK_START));
+  AddressLineTest::run(BANK_START, BANK_LENGTH, lines);
+  endRun();
+  TEST_ASSERT_EQUAL_UINT8(ADDRESS_LINE_STUCK, AddressLineTest::getState(lines, 9));
+  TEST_ASSERT_EQUAL_UINT8(ADDRESS_LINE_OK, AddressLineTest::getState(lines, 8));
+  TEST_ASSERT_EQUAL_UINT8(ADDRESS_LINE_UNTESTED, AddressLineTest::getState(lines, 14));
+
+  // A9 selects the cell of A8
+  beginRun(aliasFault(BANK_START ^ (1 << 9), BANK_START ^ (1 << 8)));
+  AddressLineTest::run(BANK_START, BANK_LENGTH, lines);
+  endRun();
+  TEST_ASSERT_EQUAL_UINT8(ADDRESS_LINE_SHORTED, AddressLineTest::getState(lines, 9));
+  TEST_ASSERT_EQUAL_UINT8(ADDRESS_LINE_SHORTED, AddressLineTest::getState(lines, 8));
+  TEST_ASSERT_EQUAL_UINT8(8, lines.partner[9]);
+}
+
+void test_quick_screen_narrows_the_region() {
+  const uint16_t length = 2 * BANK_LENGTH;
+  ScreenResult screen;
+  uint16_t regionStart;
+  uint16_t regionLength;
+
+  beginRun(FAULTS[SIM_FAULT_NONE]);
+  QuickScreen::run(BANK_START, length, MATRIX_BITS, screen);
+  endRun();
+  TEST_ASSERT_TRUE(QuickScreen::passed(screen));
+
+  // Cells off the sampled row and column lines are left to the full suite
+  beginRun(FAULTS[SIM_FAULT_STUCK_AT]);
+  QuickScreen::run(BANK_START, length, MATRIX_BITS, screen);
+  endRun();
+  TEST_ASSERT_TRUE(QuickScreen::passed(screen));
+
+  // Row 5, column 0 of the second bank is sampled
+  SimFault stuck = FAULTS[SIM_FAULT_STUCK_AT];
+  stuck.address = BANK_START + BANK_LENGTH + 5;
+  beginRun(stuck);
+  QuickScreen::run(BANK_START, length, MATRIX_BITS, screen);
+  endRun();
+  TEST_ASSERT_FALSE(QuickScreen::passed(screen));
+  TEST_ASSERT_EQUAL_HEX8(0x02, screen.blockMask);
+  QuickScreen::getRegion(screen, BANK_START, length, MATRIX_BITS, regionStart, regionLength);
+  TEST_ASSERT_EQUAL_HEX16(BANK_START + BANK_LENGTH, regionStart);
+  TEST_ASSERT_EQUAL_UINT16(BANK_LENGTH, regionLength);
+
+  // A suspect address line sends the whole range to the suite
+  beginRun(aliasFault(BANK_START ^ (1 << 9), BANK_START));
+  QuickScreen::run(BANK_START, length, MATRIX_BITS, screen);
+  endRun();
+  TEST_ASSERT_EQUAL_HEX16(1 << 9, screen.addressLines);
+  QuickScreen::getRegion(screen, BANK_START, length, MATRIX_BITS, regionStart, regionLength);
+  TEST_ASSERT_EQUAL_HEX16(BANK_START, regionStart);
+  TEST_ASSERT_EQUAL_UINT16(length, regionLength);
+}
+
+void test_row_hammer_flips_the_victim_row() {
+  RowHammerResult hammer;
+
+  beginRun(FAULTS[SIM_FAULT_NONE]);
+  RowHammerTest::run(BANK_START, 1, HAMMER_COUNT, ROW_HAMMER_DEFAULT_PATTERN, hammer);
+  endRun();
+  TEST_ASSERT_EQUAL_UINT32(0, hammer.result.totalErrors);
+  TEST_ASSERT_EQUAL_UINT16(DRAM_ROWS, hammer.victimRows);
+  TEST_ASSERT_EQUAL_UINT32(RowHammerTest::getActivations(1, HAMMER_COUNT), hammer.activations);
+
+  // Only the victim's own row flips, and only under double-sided hammering
+  beginRun(FAULTS[SIM_FAULT_ROW_HAMMER]);
+  RowHammerTest::run(BANK_START, 1, HAMMER_COUNT, ROW_HAMMER_DEFAULT_PATTERN, hammer);
+  endRun();
+  TEST_ASSERT_EQUAL_UINT16(1, hammer.flippedRows);
+  TEST_ASSERT_EQUAL_UINT32(1, hammer.result.totalErrors);
+
+  runBenchmark();
+  TEST_ASSERT_FALSE(detects("March C- Test", SIM_FAULT_ROW_HAMMER));
+}
+
+// Run the random tests of the suite with seed (0 = fresh); returns a checksum
+// of the bank afterwards and the seed the first random test ran with
+static uint32_t runRandomTests(uint16_t seed, uint16_t &firstSeed) {
+  beginRun(FAULTS[SIM_FAULT_NONE]);
+  TestResult result = {};
+  SweepScheduler scheduler;
+  scheduler.setTestMask(getSuiteFlagMask(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT,
+                                         SUITE_RANDOM_PATTERN));
+  scheduler.setSeed(seed);
+  scheduler.begin(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, BANK_START, BANK_LENGTH);
+  firstSeed = 0;
+  while (!scheduler.isDone()) {
+    scheduler.step(result, 1024);
+    if (firstSeed == 0 && scheduler.isInPass()) {
+      firstSeed = scheduler.getSeed();
+    }
+    SimBus.elapse(LOOP_MICROS);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, result.totalErrors);
+
+  uint32_t sum = 0;
+  uint8_t page[MEMORY_PAGE_SIZE];
+  for (uint32_t offset = 0; offset < BANK_LENGTH; offset += MEMORY_PAGE_SIZE) {
+    MemoryBus.readPage(BANK_START + offset, page, MEMORY_PAGE_SIZE);
+    for (uint16_t i = 0; i < MEMORY_PAGE_SIZE; i++) {
+      sum = sum * 31 + page[i];
+    }
+  }
+  endRun();
+  return sum;
+}
+
+void test_seed_replay_reproduces_a_run() {
+  TEST_ASSERT_NOT_EQUAL(0, getSuiteFlagMask(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT,
+                                            SUITE_RANDOM_PATTERN));
+
+  uint16_t fresh;
+  uint32_t original = runRandomTests(0, fresh);
+  TEST_ASSERT_NOT_EQUAL(0, fresh);
+
+  // The seed a pass printed brings back the same data, bit for bit
+  uint16_t replayed;
+  TEST_ASSERT_EQUAL_HEX32(original, runRandomTests(fresh, replayed));
+  TEST_ASSERT_EQUAL_HEX16(fresh, replayed);
+
+  uint16_t other;
+  TEST_ASSERT_NOT_EQUAL(original, runRandomTests(fresh + 1, other));
+  TEST_ASSERT_EQUAL_HEX16(fresh + 1, other);
+}
+
+// Write bytes into the simulated memory over the bus
+static void poke(uint16_t address, const char *text) {
+  MemoryBus.writePage(address, (const uint8_t *)text, strlen(text));
+}
+
+void test_pattern_search_reads_each_byte_once() {
+  uint8_t buffer[SEARCH_MIN_BUFFER];
+  uint16_t address;
+
+  TEST_ASSERT_TRUE(PatternSearch.begin("C3 00 06"));
+  TEST_ASSERT_EQUAL_UINT8(3, PatternSearch.getLength());
+  TEST_ASSERT_TRUE(PatternSearch.begin("0xC3,0x00"));
+  TEST_ASSERT_EQUAL_UINT8(2, PatternSearch.getLength());
+  TEST_ASSERT_FALSE(PatternSearch.begin("\"THIS PATTERN IS LONGER THAN THIRTY-TWO\""));
+  TEST_ASSERT_TRUE(PatternSearch.begin("\"READY\""));
+  TEST_ASSERT_EQUAL_UINT8(5, PatternSearch.getLength());
+
+  // One match across the first two bursts, one further on
+  beginRun(FAULTS[SIM_FAULT_NONE]);
+  poke(BANK_START + 62, "READY");
+  poke(BANK_START + 0x2345, "READY");
+  SimBus.resetCounts();
+
+  TEST_ASSERT_FALSE(PatternSearch.find(BANK_START, BANK_START + BANK_LENGTH, address, buffer,
+                                       SEARCH_MIN_BUFFER - 1));
+  TEST_ASSERT_TRUE(PatternSearch.find(BANK_START, BANK_START + BANK_LENGTH, address, buffer,
+                                      sizeof(buffer)));
+  TEST_ASSERT_EQUAL_HEX16(BANK_START + 62, address);
+  TEST_ASSERT_TRUE(PatternSearch.find(address + 1, BANK_START + BANK_LENGTH, address, buffer,
+                                      sizeof(buffer)));
+  TEST_ASSERT_EQUAL_HEX16(BANK_START + 0x2345, address);
+
+  // A miss costs one read of every byte
+  SimBus.resetCounts();
+  TEST_ASSERT_FALSE(PatternSearch.find(address + 1, BANK_START + BANK_LENGTH, address, buffer,
+                                       sizeof(buffer)));
+  TEST_ASSERT_EQUAL_UINT32(BANK_LENGTH - 0x2346, SimBus.getReads());
+  TEST_ASSERT_EQUAL_UINT32(0, SimBus.getWrites());
+  MemoryBus.endSession();
+}
+
+// Errors of the whole suite per titled test, fused or in the naive order
+static void runSuite(const SimFault &fault, bool fuse, uint32_t errors[32]) {
+  beginRun(fault);
+  memset(errors, 0, 32 * sizeof(uint32_t));
+  TestResult result = {};
+  SweepScheduler scheduler;
+  scheduler.setTestMask(SUITE_ALL_TESTS);
+  scheduler.setSeed(0x1234);  // The same random data in both orders
+  scheduler.begin(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, BANK_START, BANK_LENGTH, fuse);
+  while (!scheduler.isDone()) {
+    uint32_t before = result.totalErrors;
+    scheduler.step(result, 1024);
+    errors[FAULT_SOURCE_TEST(FaultLog.getSource())] += result.totalErrors - before;
+    SimBus.elapse(LOOP_MICROS);
+  }
+  endRun();
+}
+
+// Dropping a fill must not leave an upset cell for the next test to report.
+// Faults that involve a second cell depend on the pass order, which fusion
+// changes, so only faults of one cell are compared.
+void test_fusion_keeps_errors_with_their_test() {
+  static const SimFault CELL_FAULTS[] = {
+      FAULTS[SIM_FAULT_STUCK_AT],
+      FAULTS[SIM_FAULT_TRANSITION],
+      FAULTS[SIM_FAULT_READ_DISTURB],
+      {SIM_FAULT_READ_DISTURB, VICTIM, 1, 0, 0, 1},  // Upset by every read
+  };
+  uint32_t fused[32];
+  uint32_t naive[32];
+  for (uint8_t f = 0; f < sizeof(CELL_FAULTS) / sizeof(CELL_FAULTS[0]); f++) {
+    runSuite(CELL_FAULTS[f], true, fused);
+    runSuite(CELL_FAULTS[f], false, naive);
+    for (uint8_t test = 0; test < 32; test++) {
+      TEST_ASSERT_EQUAL_UINT32_MESSAGE(naive[test], fused[test],
+                                       SimBusClass::getFaultName(CELL_FAULTS[f].type));
+    }
+  }
+}
+
+void test_suite_fault_claims_hold() {
+  runBenchmark();
+  uint8_t titled = getSuiteTitledCount(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT);
+  for (uint8_t test = 0; test < titled; test++) {
+    uint8_t faults = getSuiteFaults(RAM_TEST_SUITE, RAM_TEST_SUITE_COUNT, test);
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      uint8_t type = PLAN_FAULT_SIM[bit];
+      if (!(faults & (1 << bit)) || type == SIM_FAULT_NONE) {
+        continue;
+      }
+
+      bool detected = rows[test].errors[type] > 0;
+      if (!detected) {
+        TestResult result;
+        uint32_t reported = 0;
+        runTest(test, OTHER_FAULTS[type], result, reported);
+        detected = result.totalErrors > 0;
+      }
+      char message[64];
+      snprintf(message, sizeof(message), "%s claims %s", rows[test].name,
+               SimBusClass::getFaultName(type));
+      TEST_ASSERT_TRUE_MESSAGE(detected, message);
+    }
+  }
+}
+
+static void printReport() {
+  printf("\n%-36s %9s %6s", "Test (16K bank)", "Bus ops", "/cell");
+  for (uint8_t type = 1; type < SIM_FAULT_TYPE_COUNT; type++) {
+    printf(" %12s", SimBusClass::getFaultName(type));
+  }
+  printf("\n");
+  for (uint8_t i = 0; i < rowCount; i++) {
+    const BenchRow &row = rows[i];
+    printf("%-36s %9lu %6.1f", row.name, (unsigned long)row.operations,
+           (double)row.operations / BANK_LENGTH);
+    for (uint8_t type = 1; type < SIM_FAULT_TYPE_COUNT; type++) {
+      printf(" %12s", row.errors[type] ? "detected" : "-");
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
+
+void setUp() {}
+void tearDown() {}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_no_false_positives);
+  RUN_TEST(test_march_tests_detect_static_faults);
+  RUN_TEST(test_dynamic_faults_need_their_tests);
+  RUN_TEST(test_neighbourhood_tests_detect_coupling);
+  RUN_TEST(test_suite_fault_claims_hold);
+  RUN_TEST(test_fusion_keeps_errors_with_their_test);
+  RUN_TEST(test_topology_orders_detect_static_faults);
+  RUN_TEST(test_address_lines_stuck_and_shorted);
+  RUN_TEST(test_quick_screen_narrows_the_region);
+  RUN_TEST(test_row_hammer_flips_the_victim_row);
+  RUN_TEST(test_seed_replay_reproduces_a_run);
+  RUN_TEST(test_pattern_search_reads_each_byte_once);
+  printReport();
+  return UNITY_END();
+}